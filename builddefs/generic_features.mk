@@ -39,6 +39,7 @@ GENERIC_FEATURES = \
     KEYCODE_STRING \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
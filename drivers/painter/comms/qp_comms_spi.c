@@ -45,6 +45,27 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+uint32_t qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    uint32_t       bytes_remaining = byte_count;
+    const uint8_t *p               = (const uint8_t *)data;
+    const uint32_t max_msg_length  = UINT16_MAX;
+
+    // Each message waits for the previous one to complete, only the last one is still being sent on return. Messages are
+    // as long as a single transfer allows, so that large blocks such as LVGL areas don't wait in between.
+    while (bytes_remaining > 0) {
+        uint32_t bytes_this_loop = MIN(bytes_remaining, max_msg_length);
+        spi_transmit_async(p, bytes_this_loop);
+        p += bytes_this_loop;
+        bytes_remaining -= bytes_this_loop;
+    }
+
+    return byte_count - bytes_remaining;
+}
+
+bool qp_comms_spi_busy(painter_device_t device) {
+    return spi_transmit_busy();
+}
+
 bool qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t      *driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -53,11 +74,20 @@ bool qp_comms_spi_stop(painter_device_t device) {
     return true;
 }
 
+bool qp_comms_spi_stop_async(painter_device_t device) {
+    // Chip select is deasserted along with the rest of the transaction, once the transfer completes
+    spi_stop_async();
+    return true;
+}
+
 const painter_comms_vtable_t spi_comms_vtable = {
-    .comms_init  = qp_comms_spi_init,
-    .comms_start = qp_comms_spi_start,
-    .comms_send  = qp_comms_spi_send_data,
-    .comms_stop  = qp_comms_spi_stop,
+    .comms_init       = qp_comms_spi_init,
+    .comms_start      = qp_comms_spi_start,
+    .comms_send       = qp_comms_spi_send_data,
+    .comms_send_async = qp_comms_spi_send_data_async,
+    .comms_busy       = qp_comms_spi_busy,
+    .comms_stop       = qp_comms_spi_stop,
+    .comms_stop_async = qp_comms_spi_stop_async,
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,9 +128,17 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+uint32_t qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t               *driver       = (painter_driver_t *)device;
+    qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    gpio_write_pin_high(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+
 bool qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t               *driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    spi_transmit_wait(); // any data still being sent has to go out before D/C changes
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
     return true;
@@ -135,10 +173,13 @@ bool qp_comms_spi_dc_reset_bulk_command_sequence(painter_device_t device, const
 const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
     .base =
         {
-            .comms_init  = qp_comms_spi_dc_reset_init,
-            .comms_start = qp_comms_spi_start,
-            .comms_send  = qp_comms_spi_dc_reset_send_data,
-            .comms_stop  = qp_comms_spi_stop,
+            .comms_init       = qp_comms_spi_dc_reset_init,
+            .comms_start      = qp_comms_spi_start,
+            .comms_send       = qp_comms_spi_dc_reset_send_data,
+            .comms_send_async = qp_comms_spi_dc_reset_send_data_async,
+            .comms_busy       = qp_comms_spi_busy,
+            .comms_stop       = qp_comms_spi_stop,
+            .comms_stop_async = qp_comms_spi_stop_async,
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
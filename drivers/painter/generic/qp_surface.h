@@ -63,7 +63,7 @@ painter_device_t qp_make_rgb888_surface(uint16_t panel_width, uint16_t panel_hei
 /**
  * Helper method to draw the contents of the framebuffer to the target device.
  *
- * After successful completion, the dirty area is reset.
+ * Only the dirty tiles are transferred, as one or more rectangles. After successful completion, the dirty area is reset.
  *
  * @param surface[in] the surface to copy from
  * @param target[in] the target device to copy into
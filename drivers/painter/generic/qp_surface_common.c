@@ -47,6 +47,18 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
         dirty->b        = y;
         dirty->is_dirty = true;
     }
+
+    // Maintain dirty tiles
+    dirty->tiles[y >> dirty->tile_shift_y] |= 1u << (x >> dirty->tile_shift_x);
+}
+
+// Works out the smallest power-of-two tile size that fits the given dimension into the dirty tile grid
+static uint8_t qp_surface_tile_shift(uint16_t size) {
+    uint8_t shift = 0;
+    while (((size - 1) >> shift) >= SURFACE_DIRTY_TILE_GRID) {
+        shift++;
+    }
+    return shift;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +75,15 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+    // Mark every tile covering the surface as dirty
+    surface->dirty.tile_shift_x = qp_surface_tile_shift(surface->base.panel_width);
+    surface->dirty.tile_shift_y = qp_surface_tile_shift(surface->base.panel_height);
+    uint8_t tile_cols           = ((surface->base.panel_width - 1) >> surface->dirty.tile_shift_x) + 1;
+    uint8_t tile_rows           = ((surface->base.panel_height - 1) >> surface->dirty.tile_shift_y) + 1;
+    for (uint8_t row = 0; row < SURFACE_DIRTY_TILE_GRID; ++row) {
+        surface->dirty.tiles[row] = row < tile_rows ? (UINT16_MAX >> (SURFACE_DIRTY_TILE_GRID - tile_cols)) : 0;
+    }
+
     return true;
 }
 
@@ -83,6 +104,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    memset(surface->dirty.tiles, 0, sizeof(surface->dirty.tiles));
     return true;
 }
 
@@ -105,6 +127,50 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
+// Walks the dirty tiles as rectangles clipped to the dirty region -- each run of dirty tiles in a row is merged with the
+// rows below it that have the same run dirty. Transfers each rectangle if a target is given, returning the total number
+// of pixels in the rectangles.
+static uint32_t qp_surface_walk_dirty_rects(surface_painter_device_t *surface, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool *ok) {
+    surface_dirty_data_t            *dirty  = &surface->dirty;
+    surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface->base.driver_vtable;
+
+    uint16_t tiles[SURFACE_DIRTY_TILE_GRID];
+    memcpy(tiles, dirty->tiles, sizeof(tiles));
+
+    uint32_t pixels = 0;
+    for (uint8_t row = 0; row < SURFACE_DIRTY_TILE_GRID; ++row) {
+        while (tiles[row]) {
+            // Find the first run of dirty tiles in this row
+            uint8_t first = __builtin_ctz(tiles[row]);
+            uint8_t last  = first;
+            while (last + 1 < SURFACE_DIRTY_TILE_GRID && (tiles[row] & (1u << (last + 1)))) {
+                last++;
+            }
+            uint16_t run = (UINT16_MAX >> (SURFACE_DIRTY_TILE_GRID - 1 - last)) & (UINT16_MAX << first);
+            tiles[row] &= ~run;
+
+            // Extend it down for as long as the rows below have the whole run dirty
+            uint8_t bottom = row;
+            while (bottom + 1 < SURFACE_DIRTY_TILE_GRID && (tiles[bottom + 1] & run) == run) {
+                bottom++;
+                tiles[bottom] &= ~run;
+            }
+
+            uint16_t l = MAX(first << dirty->tile_shift_x, dirty->l);
+            uint16_t t = MAX(row << dirty->tile_shift_y, dirty->t);
+            uint16_t r = MIN(((last + 1) << dirty->tile_shift_x) - 1, dirty->r);
+            uint16_t b = MIN(((bottom + 1) << dirty->tile_shift_y) - 1, dirty->b);
+            pixels += (uint32_t)(r - l + 1) * (b - t + 1);
+
+            if (target_driver && *ok) {
+                *ok = vtable->target_pixdata_transfer((painter_driver_t *)surface, target_driver, x, y, l, t, r, b);
+            }
+        }
+    }
+
+    return pixels;
+}
+
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
     painter_driver_t         *surface_driver = (painter_driver_t *)surface;
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
@@ -122,9 +188,23 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
         return false;
     }
 
-    // Offload to the pixdata transfer function
+    // Work out how much of the dirty region the dirty tiles cover
+    surface_dirty_data_t *dirty       = &surface_handle->dirty;
+    uint32_t              dirty_area  = (uint32_t)(dirty->r - dirty->l + 1) * (dirty->b - dirty->t + 1);
+    uint32_t              tiles_area  = entire_surface ? 0 : qp_surface_walk_dirty_rects(surface_handle, NULL, x, y, NULL);
+    bool                  whole_dirty = tiles_area >= dirty_area - dirty_area / 8;
+
+    // Offload to the pixdata transfer function -- if the dirty tiles cover most of the dirty region, it's cheaper to send
+    // the dirty region as a whole than to set up a transfer for each rectangle of tiles
     surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
-    bool                             ok     = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface);
+    bool                             ok     = true;
+    if (entire_surface) {
+        ok = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, 0, 0, surface_driver->panel_width - 1, surface_driver->panel_height - 1);
+    } else if (whole_dirty) {
+        ok = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, dirty->l, dirty->t, dirty->r, dirty->b);
+    } else {
+        qp_surface_walk_dirty_rects(surface_handle, target_driver, x, y, &ok);
+    }
     if (!ok) {
         qp_dprintf("qp_surface_draw: fail (could not transfer pixel data)\n");
         return false;
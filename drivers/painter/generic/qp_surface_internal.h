@@ -13,15 +13,25 @@
 typedef struct surface_painter_driver_vtable_t {
     painter_driver_vtable_t base; // must be first, so it can be cast to/from the painter_driver_vtable_t* type
 
-    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
+    // Transfers the given region of the surface, in surface coordinates, to the target with its top left corner at x,y
+    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 } surface_painter_driver_vtable_t;
 
+// The surface is split into a grid of SURFACE_DIRTY_TILE_GRID x SURFACE_DIRTY_TILE_GRID tiles for dirty tracking, each
+// row of the grid is a bitmask of its dirty tiles. Tile sizes are powers of two, so the grid may not be fully used.
+#define SURFACE_DIRTY_TILE_GRID 16
+
 typedef struct surface_dirty_data_t {
     bool     is_dirty;
     uint16_t l;
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+    // Dirty tiles, so that separate areas drawn to can be transferred without everything in between
+    uint8_t  tile_shift_x;
+    uint8_t  tile_shift_y;
+    uint16_t tiles[SURFACE_DIRTY_TILE_GRID];
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -6,6 +6,7 @@
 #    include "color.h"
 #    include "qp_draw.h"
 #    include "qp_surface_internal.h"
+#    include "qp_comms.h"
 #    include "qp_comms_dummy.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,18 +69,20 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+    // Keep the target's comms going for the whole transfer, so that pixel data can still be sent while the next chunk is gathered
+    if (!qp_comms_start((painter_device_t)target_driver)) {
+        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not start comms)\n");
+        return false;
+    }
 
     // Set the target drawing area
-    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
+    bool ok = target_driver->driver_vtable->viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
         qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_comms_stop((painter_device_t)target_driver);
         return false;
     }
 
@@ -89,34 +92,35 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
     // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = t; y <= b; ++y) {
+    for (uint16_t y = t; y <= b && ok; ++y) {
         for (uint16_t x = l; x <= r; ++x) {
             // Update the target buffer
             target_buffer[pixel_counter++] = surface_handle->u16buffer[y * surface_handle->base.panel_width + x];
 
             // If we've accumulated enough data, send it
             if (pixel_counter == total_pixel_count) {
-                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+                ok = qp_internal_send_pixdata((painter_device_t)target_driver, pixel_counter);
                 if (!ok) {
                     qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-                    return false;
+                    break;
                 }
-                // Reset the counter
+                // Reset the counter, and carry on in whichever buffer is free now
                 pixel_counter = 0;
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
             }
         }
     }
 
     // If there's any leftover data, send it
-    if (pixel_counter > 0) {
-        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+    if (ok && pixel_counter > 0) {
+        ok = qp_internal_send_pixdata((painter_device_t)target_driver, pixel_counter);
         if (!ok) {
             qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-            return false;
         }
     }
 
-    return true;
+    qp_comms_stop((painter_device_t)target_driver);
+    return ok;
 }
 
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
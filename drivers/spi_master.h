@@ -93,6 +93,30 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, without waiting for the transfer to complete.
+ *
+ * Any other operation on the SPI bus, including `spi_stop()`, waits for the transfer to complete first. The data must be left untouched until then. Platforms without asynchronous transfers send the data before returning.
+ *
+ * \param data A pointer to the data to write from.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_TIMEOUT` if the timeout period elapses, `SPI_STATUS_ERROR` if some other error occurs, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Wait for a transfer started by `spi_transmit_async()` to complete.
+ */
+void spi_transmit_wait(void);
+
+/**
+ * \brief Check whether a transfer started by `spi_transmit_async()` is still in progress.
+ *
+ * \return `true` if the transfer hasn't completed yet, otherwise `false`.
+ */
+bool spi_transmit_busy(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
@@ -109,6 +133,13 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length);
  */
 void spi_stop(void);
 
+/**
+ * \brief End the current SPI transaction once a transfer started by `spi_transmit_async()` completes, without waiting for it.
+ *
+ * No other operation may be made on the SPI bus until the next `spi_start()`, which waits for the transfer and ends the transaction first if it's still in progress. Platforms without asynchronous transfers end the transaction before returning.
+ */
+void spi_stop_async(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,12 @@ RGB rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+void rgb_matrix_hsv_to_rgb_span(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+}
+
 bool dip_switch_update_kb(uint8_t index, bool active) {
     if (!dip_switch_update_user(index, active))
         return false;
@@ -86,6 +86,7 @@ subcommands = [
     'qmk.cli.generate.keymap_h',
     'qmk.cli.generate.make_dependencies',
     'qmk.cli.generate.rgb_breathe_table',
+    'qmk.cli.generate.rgb_effect',
     'qmk.cli.generate.rules_mk',
     'qmk.cli.generate.version_h',
     'qmk.cli.git.submodule',
@@ -108,6 +109,7 @@ subcommands = [
     'qmk.cli.painter',
     'qmk.cli.pytest',
     'qmk.cli.resolve_alias',
+    'qmk.cli.scan_stats',
     'qmk.cli.test.c',
     'qmk.cli.userspace.add',
     'qmk.cli.userspace.compile',
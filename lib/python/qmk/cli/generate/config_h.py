@@ -1,5 +1,6 @@
 """Used by the make system to generate info_config.h from info.json.
 """
+import re
 from pathlib import Path
 from dotty_dict import dotty
 
@@ -12,6 +13,9 @@ from qmk.keyboard import keyboard_completer, keyboard_folder
 from qmk.commands import dump_lines, parse_configurator_json
 from qmk.path import normpath, FileType
 from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.util import maybe_exit
+
+PORT_PIN_RE = re.compile(r'^([A-Z]+)(\d+)$')
 
 
 def generate_flag(define, value=None):
@@ -55,8 +59,61 @@ def pin_array(define, pins, postfix):
     return generate_define(f'{define}_PINS{postfix}', f'{{ {pin_array} }}')
 
 
-def matrix_pins(matrix_pins, postfix=''):
+def port_runs(pins):
+    """Group pins by GPIO port so that each port can be read once per scan.
+
+    Returns a pin from each port, and the runs of consecutive port bits that map onto consecutive pin indices as
+    (port, first bit, mask, first index) tuples. Unconnected pins are skipped. Returns None if a pin is not a name of
+    the form <port><bit>, such as a raw pin number.
+    """
+    ports = {}
+    runs = []
+
+    for index, pin in enumerate(pins):
+        if pin is None or pin == 'NO_PIN':
+            continue
+
+        if not isinstance(pin, str):
+            return None
+
+        match = PORT_PIN_RE.match(pin)
+        if not match or int(match.group(2)) > 31:
+            return None
+
+        port = ports.setdefault(match.group(1), (len(ports), pin))[0]
+        bit = int(match.group(2))
+
+        if runs and runs[-1][0] == port and runs[-1][1] + runs[-1][2] == bit and runs[-1][3] + runs[-1][2] == index:
+            runs[-1][2] += 1
+        else:
+            runs.append([port, bit, 1, index])
+
+    return [pin for _, pin in ports.values()], [(port, bit, (1 << length) - 1, index) for port, bit, length, index in runs]
+
+
+def port_array(define, pins, postfix):
+    """Return the config.h lines that set the port tables used by MATRIX_PORT_SCAN.
+    """
+    grouped = port_runs(pins)
+    if grouped is None:
+        cli.log.error(f'{{fg_red}}Error:{{fg_reset}} Unable to group {define}_PINS{postfix} by port. matrix_pins.port_scan requires pin names of the form <port><bit>, such as B12.')
+        maybe_exit(1)
+        return ''
+
+    ports, runs = grouped
+    port_array = ', '.join(ports)
+    run_array = ', '.join(f'{{{port}, {bit}, 0x{mask:X}, {index}}}' for port, bit, mask, index in runs)
+
+    return '\n'.join([
+        generate_define(f'{define}_PORTS{postfix}', f'{{ {port_array} }}'),
+        generate_define(f'{define}_PORT_RUNS{postfix}', f'{{ {run_array} }}'),
+    ])
+
+
+def matrix_pins(matrix_pins, postfix='', port_scan=False, diode_direction='COL2ROW'):
     """Add the matrix config to the config.h.
+
+    With port_scan, the port tables are generated for whichever of the rows and columns are read as inputs.
     """
     pins = []
 
@@ -65,9 +122,13 @@ def matrix_pins(matrix_pins, postfix=''):
 
     if 'cols' in matrix_pins:
         pins.append(pin_array('MATRIX_COL', matrix_pins['cols'], postfix))
+        if port_scan and diode_direction == 'COL2ROW':
+            pins.append(port_array('MATRIX_COL', matrix_pins['cols'], postfix))
 
     if 'rows' in matrix_pins:
         pins.append(pin_array('MATRIX_ROW', matrix_pins['rows'], postfix))
+        if port_scan and diode_direction != 'COL2ROW':
+            pins.append(port_array('MATRIX_ROW', matrix_pins['rows'], postfix))
 
     return '\n'.join(pins)
 
@@ -156,7 +217,7 @@ def generate_split_config(kb_info_json, config_h_lines):
             config_h_lines.append(generate_define('USE_I2C'))
 
     if 'right' in kb_info_json['split'].get('matrix_pins', {}):
-        config_h_lines.append(matrix_pins(kb_info_json['split']['matrix_pins']['right'], '_RIGHT'))
+        config_h_lines.append(matrix_pins(kb_info_json['split']['matrix_pins']['right'], '_RIGHT', kb_info_json.get('matrix_pins', {}).get('port_scan', False), kb_info_json.get('diode_direction', 'COL2ROW')))
 
     if 'right' in kb_info_json['split'].get('encoder', {}):
         generate_encoder_config(kb_info_json['split']['encoder']['right'], config_h_lines, '_RIGHT')
@@ -197,7 +258,7 @@ def generate_config_h(cli):
     generate_matrix_size(kb_info_json, config_h_lines)
 
     if 'matrix_pins' in kb_info_json:
-        config_h_lines.append(matrix_pins(kb_info_json['matrix_pins']))
+        config_h_lines.append(matrix_pins(kb_info_json['matrix_pins'], port_scan=kb_info_json['matrix_pins'].get('port_scan', False), diode_direction=kb_info_json.get('diode_direction', 'COL2ROW')))
 
     if 'encoder' in kb_info_json:
         generate_encoder_config(kb_info_json['encoder'], config_h_lines)
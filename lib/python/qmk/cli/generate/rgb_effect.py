@@ -0,0 +1,300 @@
+"""Compile a declarative RGB Matrix effect description into C.
+
+The input is a JSON file describing one or more effects:
+
+    {
+        "effects": {
+            "ocean_wave": {"type": "wave", "axis": "x", "channel": "val", "frequency": 4},
+            "sunburst": {"type": "radial", "twist": 2}
+        }
+    }
+
+The output is a `rgb_matrix_user.inc` compatible file. Angles and distances from the
+matrix center are computed here from the keyboard's `rgb_matrix.layout`, so the
+generated effects only do table lookups per LED instead of `atan2_8()`/`sqrt16()`.
+"""
+import math
+import textwrap
+
+from jsonschema import ValidationError
+from milc import cli
+
+from qmk.commands import dump_lines
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.info import info_json
+from qmk.json_schema import json_load, validate
+from qmk.keyboard import keyboard_completer, keyboard_folder
+from qmk.keymap import keymap_completer, locate_keymap
+from qmk.path import normpath
+from qmk.util import maybe_exit
+
+DEFAULT_CENTER = (112, 32)
+
+EFFECT_DEFAULTS = {
+    'gradient': {'axis': 'x', 'spread': 255, 'speed': 0},
+    'wave': {'axis': 'x', 'channel': 'val', 'frequency': 4, 'speed': 1},
+    'radial': {'twist': 0, 'speed': 1},
+    'reactive': {'radius': 64, 'hue_shift': 0, 'multi': False},
+}
+
+CHANNELS = {'hue': 'h', 'sat': 's', 'val': 'v'}
+
+
+def _c_div(a, b):
+    """Integer division truncating towards zero, as C does.
+    """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+def atan2_8(dy, dx):
+    """Python port of lib8tion's atan2_8(), so tables match the built-in effects.
+    """
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - _c_div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - _c_div(32 * (dx + abs_y), abs_y - dx)
+
+    if dy < 0:
+        a = -a
+
+    return a & 0xFF
+
+
+def sqrt16(x):
+    """Python port of lib8tion's sqrt16().
+    """
+    return min(math.isqrt(x), 255)
+
+
+def led_polar_table(info_data):
+    """Returns (angle, distance) for every LED in `rgb_matrix.layout` relative to the matrix center.
+    """
+    center_x, center_y = info_data.get('rgb_matrix', {}).get('center_point', DEFAULT_CENTER)
+
+    table = []
+    for led in info_data['rgb_matrix']['layout']:
+        dx = led.get('x', 0) - center_x
+        dy = led.get('y', 0) - center_y
+        table.append((atan2_8(dy, dx), sqrt16(dx * dx + dy * dy)))
+
+    return table
+
+
+def _coord(axis):
+    """C expression for a per-LED coordinate, in the 0-255 range.
+    """
+    if axis == 'x':
+        return 'g_led_config.point[i].x'
+    if axis == 'y':
+        return 'g_led_config.point[i].y'
+    if axis == 'angle':
+        return 'pgm_read_byte(&rgb_effect_led_angle[i])'
+
+    return 'pgm_read_byte(&rgb_effect_led_dist[i])'
+
+
+def _time(speed):
+    """C expression for the animated time term, or None for static effects.
+    """
+    if speed == 0:
+        return None
+    if speed == 1:
+        return 'time'
+
+    return f'(uint8_t)(time * {speed})'
+
+
+def _gen_gradient(name, effect):
+    term = f'scale8({_coord(effect["axis"])}, {effect["spread"]})'
+    time = _time(effect['speed'])
+    if time:
+        term += f' + {time}'
+
+    return [
+        f'static hsv_t {name}_math(hsv_t hsv, uint8_t i, uint8_t time) {{',
+        f'    hsv.h += {term};',
+        '    return hsv;',
+        '}',
+        '',
+        f'static bool {name}(effect_params_t* params) {{',
+        f'    return effect_runner_i(params, &{name}_math);',
+        '}',
+    ]
+
+
+def _gen_wave(name, effect):
+    phase = f'{_coord(effect["axis"])} * {effect["frequency"]}'
+    time = _time(effect['speed'])
+    if time:
+        phase += f' - {time}'
+    channel = CHANNELS[effect['channel']]
+
+    return [
+        f'static hsv_t {name}_math(hsv_t hsv, uint8_t i, uint8_t time) {{',
+        f'    hsv.{channel} = scale8(hsv.{channel}, sin8((uint8_t)({phase})));',
+        '    return hsv;',
+        '}',
+        '',
+        f'static bool {name}(effect_params_t* params) {{',
+        f'    return effect_runner_i(params, &{name}_math);',
+        '}',
+    ]
+
+
+def _gen_radial(name, effect):
+    term = _coord('angle')
+    if effect['twist']:
+        term += f' + {_coord("distance")} * {effect["twist"]}'
+    time = _time(effect['speed'])
+    if time:
+        term += f' + {time}'
+
+    return [
+        f'static hsv_t {name}_math(hsv_t hsv, uint8_t i, uint8_t time) {{',
+        f'    hsv.h += (uint8_t)({term});',
+        '    return hsv;',
+        '}',
+        '',
+        f'static bool {name}(effect_params_t* params) {{',
+        f'    return effect_runner_i(params, &{name}_math);',
+        '}',
+    ]
+
+
+def _gen_reactive(name, effect):
+    lines = [
+        f'static hsv_t {name}_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {{',
+        f'    uint16_t effect = tick + dist * 255 / {effect["radius"]};',
+        '    if (effect > 255) effect = 255;',
+    ]
+    if effect['hue_shift']:
+        lines.append(f'    hsv.h += scale8(255 - effect, {effect["hue_shift"]});')
+    lines.extend([
+        '    hsv.v = qadd8(hsv.v, 255 - effect);',
+        '    return hsv;',
+        '}',
+        '',
+        f'static bool {name}(effect_params_t* params) {{',
+        f'    return effect_runner_reactive_splash({"0" if effect["multi"] else "qsub8(g_last_hit_tracker.count, 1)"}, params, &{name}_math);',
+        '}',
+    ])
+
+    return lines
+
+
+GENERATORS = {
+    'gradient': _gen_gradient,
+    'wave': _gen_wave,
+    'radial': _gen_radial,
+    'reactive': _gen_reactive,
+}
+
+
+def _uses_polar(effect):
+    return effect['type'] == 'radial' or effect.get('axis') in ('angle', 'distance')
+
+
+def _gen_polar_tables(table):
+    angles = ', '.join(str(angle) for angle, _ in table)
+    dists = ', '.join(str(dist) for _, dist in table)
+
+    return [
+        f'STATIC_ASSERT(RGB_MATRIX_LED_COUNT == {len(table)}, "LED count changed, regenerate this file");',
+        '',
+        '// clang-format off',
+        'static const uint8_t rgb_effect_led_angle[RGB_MATRIX_LED_COUNT] PROGMEM = {',
+        textwrap.fill(angles, width=100, initial_indent='    ', subsequent_indent='    '),
+        '};',
+        '',
+        'static const uint8_t rgb_effect_led_dist[RGB_MATRIX_LED_COUNT] PROGMEM = {',
+        textwrap.fill(dists, width=100, initial_indent='    ', subsequent_indent='    '),
+        '};',
+        '// clang-format on',
+        '',
+    ]
+
+
+def generate_rgb_effect_lines(effects, polar_table=None):
+    """Builds the lines of a `rgb_matrix_user.inc` implementing `effects`.
+    """
+    lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '// !!! DO NOT ADD #pragma once !!! //', '']
+
+    for name in effects:
+        lines.append(f'RGB_MATRIX_EFFECT({name})')
+
+    lines.extend(['', '#ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS', ''])
+
+    if any(effect['type'] == 'reactive' for effect in effects.values()):
+        lines.extend([
+            '#    ifndef RGB_MATRIX_KEYREACTIVE_ENABLED',
+            '#        error "Reactive effects require RGB_MATRIX_KEYPRESSES or RGB_MATRIX_KEYRELEASES to be defined"',
+            '#    endif',
+            '',
+        ])
+
+    if polar_table is not None:
+        lines.extend(_gen_polar_tables(polar_table))
+
+    for name, effect in effects.items():
+        lines.append(f'// {name}: {effect["type"]}')
+        lines.extend(GENERATORS[effect['type']](name, effect))
+        lines.append('')
+
+    lines.append('#endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS')
+
+    return lines
+
+
+def load_effects(filename):
+    """Loads and validates an effect description, filling in defaults.
+    """
+    data = json_load(filename)
+
+    try:
+        validate(data, 'qmk.rgb_effect.v1')
+    except ValidationError as e:
+        cli.log.error('Invalid effect description {fg_cyan}%s{fg_reset}: %s', filename, e.message)
+        maybe_exit(1)
+
+    effects = {}
+    for name, effect in data['effects'].items():
+        effects[name] = {**EFFECT_DEFAULTS[effect['type']], **effect}
+
+    return effects
+
+
+@cli.argument('filename', type=normpath, help='The effect description file')
+@cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard whose LED layout the effects are compiled for.')
+@cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to write rgb_matrix_user.inc for. Ignored when a output file is supplied.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Compile a declarative RGB Matrix effect description into C.')
+def generate_rgb_effect(cli):
+    effects = load_effects(cli.args.filename)
+
+    current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_rgb_effect.keyboard
+    current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_rgb_effect.keymap
+
+    polar_table = None
+    if any(_uses_polar(effect) for effect in effects.values()):
+        if not current_keyboard:
+            cli.log.error('Angle and distance based effects need a keyboard to precompute LED positions, specify one with {fg_cyan}--keyboard{fg_reset}.')
+            return False
+
+        kb_info_json = info_json(current_keyboard)
+        if 'layout' not in kb_info_json.get('rgb_matrix', {}):
+            cli.log.error('Keyboard {fg_cyan}%s{fg_reset} does not define {fg_cyan}rgb_matrix.layout{fg_reset} in info.json.', current_keyboard)
+            return False
+
+        polar_table = led_polar_table(kb_info_json)
+
+    if not cli.args.output and current_keyboard and current_keymap:
+        cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'rgb_matrix_user.inc'
+
+    # Show the results
+    dump_lines(cli.args.output, generate_rgb_effect_lines(effects, polar_table), cli.args.quiet)
@@ -31,6 +31,7 @@ def painter_make_font_image(cli):
 @cli.argument('-u', '--unicode-glyphs', default='', help='Also generate the specified unicode glyphs.')
 @cli.argument('-f', '--format', required=True, help=f'Output format, valid types: {", ".join(valid_formats.keys())}')
 @cli.argument('-r', '--no-rle', arg_only=True, action='store_true', help='Disable the use of RLE to minimise converted image size.')
+@cli.argument('-z', '--lz', arg_only=True, action='store_true', help='Enable the use of LZ compression to minimise converted image size. Requires QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION.')
 @cli.argument('-w', '--raw', arg_only=True, action='store_true', help='Writes out the QFF file as raw data instead of c/h combo.')
 @cli.subcommand('Converts an input font image to something QMK firmware understands')
 def painter_convert_font_image(cli):
@@ -51,7 +52,7 @@ def painter_convert_font_image(cli):
 
     # Render out the data
     out_data = BytesIO()
-    font.save_to_qff(format, not cli.args.no_rle, out_data)
+    font.save_to_qff(format, not cli.args.no_rle, out_data, use_lz=cli.args.lz)
     out_bytes = out_data.getvalue()
 
     if cli.args.raw:
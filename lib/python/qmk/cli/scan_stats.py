@@ -0,0 +1,132 @@
+"""Read the scan rate statistics of a keyboard over its VIA raw HID interface.
+
+The keyboard needs to be built with `VIA_ENABLE` and `SCAN_STATS_ENABLE`.
+"""
+import struct
+import time
+
+from milc import cli
+
+RAW_USAGE_PAGE = 0xFF60
+RAW_USAGE = 0x61
+RAW_EPSIZE = 32
+
+ID_CUSTOM_SET_VALUE = 0x07
+ID_CUSTOM_GET_VALUE = 0x08
+ID_UNHANDLED = 0xFF
+ID_CUSTOM_CHANNEL = 0x00
+ID_QMK_SCAN_STATS = 0xFE
+
+SCAN_STATS_FORMAT = '>IHHHHHHHBH'
+SCAN_STATS_FIELDS = ('scans', 'window', 'period_avg_us', 'period_min', 'period_max', 'period_p50', 'period_p90', 'period_p99', 'worst_task', 'worst_task_time')
+
+TASK_NAMES = ('matrix', 'quantum', 'lighting', 'input', 'display', 'other', 'main loop')
+
+
+def _parse_device(value):
+    """Parses a VID:PID pair in hex.
+    """
+    vid, pid = value.split(':')
+    return int(vid, 16), int(pid, 16)
+
+
+def _find_device(vid_pid):
+    """Returns the path of the first VIA raw HID interface, optionally matching `vid_pid`.
+    """
+    import hid
+
+    for device in hid.enumerate():
+        if device['usage_page'] != RAW_USAGE_PAGE or device['usage'] != RAW_USAGE:
+            continue
+        if vid_pid and (device['vendor_id'], device['product_id']) != vid_pid:
+            continue
+        return device
+
+    return None
+
+
+def _command(device, command_id, *data):
+    """Sends a VIA command and returns the payload of the reply, which follows the echoed command and `data`.
+    """
+    request = bytes([command_id, *data]).ljust(RAW_EPSIZE, b'\0')
+    # The first byte is the report ID, which raw HID doesn't use
+    device.write(b'\0' + request)
+    reply = device.read(RAW_EPSIZE, 1000)
+
+    if len(reply) < RAW_EPSIZE or reply[0] == ID_UNHANDLED:
+        return None
+
+    return reply[1 + len(data):]
+
+
+def parse_scan_stats(payload):
+    """Turns the payload of an `id_qmk_scan_stats` reply into a dict.
+    """
+    return dict(zip(SCAN_STATS_FIELDS, struct.unpack_from(SCAN_STATS_FORMAT, payload)))
+
+
+def _print_scan_stats(stats):
+    if not stats['scans']:
+        cli.log.info('No complete statistics window yet.')
+        return
+
+    task = TASK_NAMES[stats['worst_task']] if stats['worst_task'] < len(TASK_NAMES) else stats['worst_task']
+    cli.echo(
+        '%d scans in %dms (%d/s) | period avg %dus min %dus p50 %dus p90 %dus p99 %dus max %dus | worst task: %s %dus',
+        stats['scans'],
+        stats['window'],
+        stats['scans'] * 1000 // stats['window'],
+        stats['period_avg_us'],
+        stats['period_min'],
+        stats['period_p50'],
+        stats['period_p90'],
+        stats['period_p99'],
+        stats['period_max'],
+        task,
+        stats['worst_task_time'],
+    )
+
+
+@cli.argument('-d', '--device', arg_only=True, type=_parse_device, help='The VID:PID of the keyboard, in hex. Defaults to the first VIA capable keyboard.')
+@cli.argument('-w', '--watch', arg_only=True, action='store_true', help='Keep printing the statistics of every window.')
+@cli.argument('-r', '--reset', arg_only=True, action='store_true', help='Reset the statistics before reading them.')
+@cli.subcommand('Read the scan rate statistics of a keyboard.')
+def scan_stats(cli):
+    """Reads the scan rate statistics of a keyboard over raw HID.
+    """
+    import hid
+
+    device_info = _find_device(cli.args.device)
+    if not device_info:
+        cli.log.error('No keyboard with a VIA raw HID interface found.')
+        return False
+
+    device = hid.Device(path=device_info['path'])
+    cli.log.info('Reading scan statistics from {fg_cyan}%s %s{fg_reset}', device_info['manufacturer_string'], device_info['product_string'])
+
+    try:
+        if cli.args.reset and _command(device, ID_CUSTOM_SET_VALUE, ID_CUSTOM_CHANNEL, ID_QMK_SCAN_STATS) is None:
+            cli.log.error('The keyboard does not support scan statistics, make sure it is built with {fg_cyan}SCAN_STATS_ENABLE = yes{fg_reset}.')
+            return False
+
+        last = None
+        while True:
+            payload = _command(device, ID_CUSTOM_GET_VALUE, ID_CUSTOM_CHANNEL, ID_QMK_SCAN_STATS)
+            if payload is None:
+                cli.log.error('The keyboard does not support scan statistics, make sure it is built with {fg_cyan}SCAN_STATS_ENABLE = yes{fg_reset}.')
+                return False
+
+            stats = parse_scan_stats(payload)
+            if stats != last:
+                _print_scan_stats(stats)
+                last = stats
+
+            if not cli.args.watch:
+                break
+            time.sleep(0.25)
+
+    except KeyboardInterrupt:
+        pass
+
+    finally:
+        device.close()
@@ -34,6 +34,7 @@ __KEYMAP_GOES_HERE__
 __ENCODER_MAP_GOES_HERE__
 __DIP_SWITCH_MAP_GOES_HERE__
 __MACRO_OUTPUT_GOES_HERE__
+__LEADER_TRIE_GOES_HERE__
 
 #ifdef OTHER_KEYMAP_C
 #    include OTHER_KEYMAP_C
@@ -141,6 +142,39 @@ def _generate_macros_function(keymap_json):
     return macro_txt
 
 
+def _generate_leader_trie(keymap_json):
+    """Compiles `leader_sequences` into a trie, flattened breadth first so the children of each node are adjacent.
+    """
+    root = {'keycode': 'KC_NO', 'action': 'KC_NO', 'children': {}, 'path': []}
+
+    for entry in keymap_json['leader_sequences']:
+        node = root
+        for keycode in map(_strip_any, entry['sequence']):
+            node = node['children'].setdefault(keycode, {'keycode': keycode, 'action': 'KC_NO', 'children': {}, 'path': node['path'] + [keycode]})
+
+        if node['action'] != 'KC_NO':
+            cli.log.warning('Leader sequence %s is defined more than once, only the first one is used.', ', '.join(node['path']))
+            continue
+        node['action'] = _strip_any(entry['keycode'])
+
+    nodes = [root]
+    for node in nodes:
+        node['first_child'] = len(nodes)
+        nodes.extend(node['children'].values())
+
+    lines = [
+        '#if defined(LEADER_ENABLE)',
+        '#    define LEADER_TRIE_ENABLE',
+        '// clang-format off',
+        'const leader_trie_node_t PROGMEM leader_trie[] = {',
+    ]
+    for index, node in enumerate(nodes):
+        comment = ', '.join(node['path']) if node['path'] else 'root'
+        lines.append(f'    [{index}] = {{{node["keycode"]}, {node["action"]}, {node["first_child"]}, {len(node["children"])}}}, // {comment}')
+    lines.extend(['};', '// clang-format on', '#endif // defined(LEADER_ENABLE)'])
+    return lines
+
+
 def _strip_any(keycode):
     """Remove ANY() from a keycode.
     """
@@ -292,6 +326,9 @@ def generate_c(keymap_json):
 
         macros
             A sequence of strings containing macros to implement for this keyboard.
+
+        leader_sequences
+            A sequence of leader key sequences, each with the keycode to tap when it is typed.
     """
     new_keymap = DEFAULT_KEYMAP_C
 
@@ -319,6 +356,12 @@ def generate_c(keymap_json):
         macros = '\n'.join(macro_txt)
     new_keymap = new_keymap.replace('__MACRO_OUTPUT_GOES_HERE__', macros)
 
+    leader_trie = ''
+    if 'leader_sequences' in keymap_json and keymap_json['leader_sequences'] is not None:
+        leader_txt = _generate_leader_trie(keymap_json)
+        leader_trie = '\n'.join(leader_txt)
+    new_keymap = new_keymap.replace('__LEADER_TRIE_GOES_HERE__', leader_trie)
+
     hostlang = ''
     if 'host_language' in keymap_json and keymap_json['host_language'] is not None:
         hostlang = f'#include "keymap_{keymap_json["host_language"]}.h"\n#include "sendstring_{keymap_json["host_language"]}.h"\n'
@@ -3,6 +3,7 @@
 import datetime
 import math
 import re
+from collections import deque
 from pathlib import Path
 from string import Template
 from PIL import Image, ImageOps
@@ -454,3 +455,84 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    """Compresses the data with QMK LZ, a byte-oriented LZ77 variant with a 256 byte window.
+
+    Each control byte is followed either by 1..128 literal bytes (`0x00..0x7F`), or by the distance of a match of 3..130
+    bytes earlier in the output (`0x80..0xFF`, distance minus one in the next byte). See `quantum_painter_lz.md`.
+    """
+    window_size = 256
+    min_match = 3
+    max_match = 130
+    max_literals = 128
+
+    output = []
+    literals = []
+    candidates = {}  # most recent positions of each sequence of `min_match` bytes, newest last
+
+    def flush_literals():
+        if literals:
+            output.append(len(literals) - 1)
+            output.extend(literals)
+            literals.clear()
+
+    def remember(pos):
+        if pos + min_match <= len(bytearray):
+            positions = candidates.setdefault(tuple(bytearray[pos:pos + min_match]), deque())
+            positions.append(pos)
+            while pos - positions[0] > window_size:
+                positions.popleft()
+
+    n = 0
+    while n < len(bytearray):
+        # Find the longest match within the window, preferring the closest one
+        match_length = 0
+        match_distance = 0
+        for pos in reversed(candidates.get(tuple(bytearray[n:n + min_match]), ())):
+            if n - pos > window_size:
+                break
+            length = min_match
+            while length < max_match and n + length < len(bytearray) and bytearray[pos + length] == bytearray[n + length]:
+                length += 1
+            if length > match_length:
+                match_length = length
+                match_distance = n - pos
+                if length == max_match:
+                    break
+
+        if match_length >= min_match:
+            flush_literals()
+            output.append(0x80 + match_length - min_match)
+            output.append(match_distance - 1)
+            step = match_length
+        else:
+            literals.append(bytearray[n])
+            if len(literals) == max_literals:
+                flush_literals()
+            step = 1
+
+        for pos in range(n, n + step):
+            remember(pos)
+        n += step
+
+    flush_literals()
+    return output
+
+
+def compress_bytes_qmk(bytearray, *, use_rle, use_lz):
+    """Compresses the data with whichever of the allowed schemes gives the smallest output.
+
+    Returns the compression scheme (see qp_internal_formats.h, painter_compression_t) and the compressed data.
+    """
+    best = (0x00, bytearray)
+    if use_rle:
+        rle_data = compress_bytes_qmk_rle(bytearray)
+        if len(rle_data) < len(best[1]):
+            best = (0x01, rle_data)
+    if use_lz:
+        lz_data = compress_bytes_qmk_lz(bytearray)
+        if len(lz_data) < len(best[1]):
+            best = (0x02, lz_data)
+    return best
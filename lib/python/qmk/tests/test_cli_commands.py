@@ -160,6 +160,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
 
 
+
 #ifdef OTHER_KEYMAP_C
 #    include OTHER_KEYMAP_C
 #endif // OTHER_KEYMAP_C
@@ -176,6 +177,19 @@ def test_json2c_macros():
     assert 'SEND_STRING("Hello, World!"SS_TAP(X_ENTER));' in result.stdout
 
 
+def test_json2c_leader_sequences():
+    result = check_subcommand("json2c", 'keyboards/handwired/pytest/basic/keymaps/leader_json/keymap.json')
+    check_returncode(result)
+    assert '#    define LEADER_TRIE_ENABLE' in result.stdout
+    assert '[0] = {KC_NO, KC_NO, 1, 2}, // root' in result.stdout
+    assert '[1] = {KC_A, KC_NO, 3, 2}, // KC_A' in result.stdout
+    assert '[2] = {KC_G, KC_NO, 5, 1}, // KC_G' in result.stdout
+    assert '[3] = {KC_S, KC_1, 6, 0}, // KC_A, KC_S' in result.stdout
+    assert '[4] = {KC_D, KC_2, 6, 1}, // KC_A, KC_D' in result.stdout
+    assert '[5] = {KC_H, LCTL(KC_H), 7, 0}, // KC_G, KC_H' in result.stdout
+    assert '[6] = {KC_F, KC_3, 7, 0}, // KC_A, KC_D, KC_F' in result.stdout
+
+
 def test_json2c_stdin():
     result = check_subcommand_stdin('keyboards/handwired/pytest/basic/keymaps/default_json/keymap.json', 'json2c', '-')
     check_returncode(result)
@@ -198,6 +212,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
 
 
+
 #ifdef OTHER_KEYMAP_C
 #    include OTHER_KEYMAP_C
 #endif // OTHER_KEYMAP_C
@@ -291,6 +306,15 @@ def test_generate_rgb_breathe_table():
     assert 'Breathing max:    127' in result.stdout
 
 
+def test_generate_rgb_effect():
+    result = check_subcommand('generate-rgb-effect', '-kb', 'labbe/labbeminiv1', 'lib/python/qmk/tests/rgb_effect.json')
+    check_returncode(result)
+    assert 'RGB_MATRIX_EFFECT(sunburst)' in result.stdout
+    assert 'static const uint8_t rgb_effect_led_angle[RGB_MATRIX_LED_COUNT] PROGMEM = {' in result.stdout
+    assert '    192, 113, 64, 15' in result.stdout
+    assert 'static bool ocean_wave(effect_params_t* params) {' in result.stdout
+
+
 def test_generate_config_h():
     result = check_subcommand('generate-config-h', '-kb', 'handwired/pytest/basic')
     check_returncode(result)
@@ -0,0 +1,84 @@
+from contextlib import contextmanager
+
+from milc import cli
+
+import qmk.util
+from qmk.cli.generate import config_h
+from qmk.tests.attrdict import AttrDict
+
+
+@contextmanager
+def keyboard_config_h(should_exit=True):
+    """Generate defines as for a keyboard level config.h, optionally without exiting on errors.
+    """
+    args = cli.args
+    cli.args = AttrDict(filename=None)
+    qmk.util.maybe_exit_config(should_exit=should_exit)
+    try:
+        yield
+    finally:
+        cli.args = args
+        qmk.util.maybe_exit_config()
+
+
+def test_port_runs_consecutive():
+    ports, runs = config_h.port_runs(['B0', 'B1', 'B2', 'A8', 'A9', 'B5'])
+    assert ports == ['B0', 'A8']
+    assert runs == [(0, 0, 0x7, 0), (1, 8, 0x3, 3), (0, 5, 0x1, 5)]
+
+
+def test_port_runs_reversed():
+    ports, runs = config_h.port_runs(['C3', 'C2', 'C1'])
+    assert ports == ['C3']
+    assert runs == [(0, 3, 0x1, 0), (0, 2, 0x1, 1), (0, 1, 0x1, 2)]
+
+
+def test_port_runs_skips_unconnected():
+    ports, runs = config_h.port_runs(['B0', None, 'NO_PIN', 'B3', 'B4'])
+    assert ports == ['B0']
+    assert runs == [(0, 0, 0x1, 0), (0, 3, 0x3, 3)]
+
+
+def test_port_runs_multi_letter_port():
+    ports, runs = config_h.port_runs(['GP0', 'GP1', 'GP29'])
+    assert ports == ['GP0']
+    assert runs == [(0, 0, 0x3, 0), (0, 29, 0x1, 2)]
+
+
+def test_port_runs_unsupported():
+    for pins in (['B0', 5], ['B0', 'B32'], ['B0', 'PIN_B1'], ['B0', 'b1']):
+        assert config_h.port_runs(pins) is None, pins
+
+
+def test_port_array():
+    with keyboard_config_h():
+        lines = config_h.port_array('MATRIX_COL', ['A0', 'A1', 'B4'], '_RIGHT')
+
+    assert '#    define MATRIX_COL_PORTS_RIGHT { A0, B4 }' in lines
+    assert '#    define MATRIX_COL_PORT_RUNS_RIGHT { {0, 0, 0x3, 0}, {1, 4, 0x1, 2} }' in lines
+
+
+def test_port_array_unsupported():
+    with keyboard_config_h(should_exit=False):
+        assert config_h.port_array('MATRIX_COL', ['A0', 1], '') == ''
+
+    try:
+        with keyboard_config_h():
+            config_h.port_array('MATRIX_COL', ['A0', 1], '')
+    except SystemExit as e:
+        assert e.code == 1
+    else:
+        assert False, 'port_array() did not exit'
+
+
+def test_matrix_pins_port_scan_inputs_only():
+    pins = {'cols': ['A0', 'A1'], 'rows': ['B5', 'B7']}
+
+    with keyboard_config_h():
+        col2row = config_h.matrix_pins(pins, port_scan=True, diode_direction='COL2ROW')
+        row2col = config_h.matrix_pins(pins, port_scan=True, diode_direction='ROW2COL')
+
+    assert 'MATRIX_COL_PORTS' in col2row
+    assert 'MATRIX_ROW_PORTS' not in col2row
+    assert 'MATRIX_COL_PORTS' not in row2col
+    assert 'MATRIX_ROW_PORTS' in row2col
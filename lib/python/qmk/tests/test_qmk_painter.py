@@ -0,0 +1,58 @@
+from qmk.painter import compress_bytes_qmk_lz
+
+# Also checked by tests/painter/lz_compression, so that the encoder and the firmware's decoder agree on the format
+LZ_INPUT = b'abcabcabcccc' + b'Quantum Painter, Quantum Painter!' + b'\x07' * 140
+LZ_EXPECTED = [
+    0x02, 0x61, 0x62, 0x63, 0x83, 0x02, 0x80, 0x00, 0x10, 0x51, 0x75, 0x61, 0x6E, 0x74, 0x75, 0x6D, 0x20, 0x50,
+    0x61, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x8C, 0x10, 0x01, 0x21, 0x07, 0xFF, 0x00, 0x86, 0x00
+]
+
+
+def decompress_qmk_lz(data):
+    """Decodes QMK LZ as described in quantum_painter_lz.md.
+    """
+    output = []
+    n = 0
+    while n < len(data):
+        control = data[n]
+        if control < 0x80:
+            output.extend(data[n + 1:n + 2 + control])
+            n += 2 + control
+        else:
+            distance = data[n + 1] + 1
+            for _ in range(control - 0x80 + 3):
+                output.append(output[-distance])
+            n += 2
+    return bytes(output)
+
+
+def test_compress_bytes_qmk_lz_expected():
+    assert compress_bytes_qmk_lz(LZ_INPUT) == LZ_EXPECTED
+
+
+def test_compress_bytes_qmk_lz_round_trip():
+    seed = 1
+    noise = []
+    for _ in range(3000):
+        seed = (seed * 1103515245 + 12345) & 0xFFFFFFFF
+        noise.append((seed >> 16) & 0xFF)
+
+    inputs = [
+        b'',
+        b'*',
+        b'\x07' * 1000,
+        bytes(i % 200 for i in range(3000)),  # matches at the far end of the window
+        bytes(i % 256 for i in range(3000)),  # matches as far back as the window reaches
+        bytes(noise),  # long literal runs
+        LZ_INPUT,
+    ]
+
+    for data in inputs:
+        compressed = compress_bytes_qmk_lz(data)
+        assert decompress_qmk_lz(compressed) == data
+        assert all(0 <= b <= 0xFF for b in compressed)
+
+
+def test_compress_bytes_qmk_lz_compresses():
+    data = bytes(i % 16 for i in range(4096))
+    assert len(compress_bytes_qmk_lz(data)) < len(data) // 10
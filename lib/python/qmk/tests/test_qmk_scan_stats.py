@@ -0,0 +1,61 @@
+from qmk.cli import scan_stats
+
+
+class FakeDevice:
+    """Answers VIA commands like a keyboard would, using the `hid.Device` read/write API.
+    """
+    def __init__(self, reply):
+        self.reply = reply
+        self.written = []
+
+    def write(self, data):
+        self.written.append(data)
+        return len(data)
+
+    def read(self, size, timeout=None):
+        assert timeout is not None
+        return self.reply[:size]
+
+
+# An id_custom_get_value reply laid out like via.c does
+SCAN_STATS_REPLY = bytes([
+    0x08, 0x00, 0xFE,  # id_custom_get_value, id_custom_channel, id_qmk_scan_stats
+    0x00, 0x01, 0x86, 0xA0,  # scans
+    0x03, 0xE8,  # window
+    0x00, 0x0A,  # period_avg_us
+    0x00, 0x08,  # period_min
+    0x01, 0xF4,  # period_max
+    0x00, 0x09,  # period_p50
+    0x00, 0x0B,  # period_p90
+    0x00, 0x5F,  # period_p99
+    0x02,  # worst_task
+    0x01, 0x2C,  # worst_task_time
+]).ljust(scan_stats.RAW_EPSIZE, b'\0')
+
+
+def test_parse_scan_stats():
+    assert scan_stats.parse_scan_stats(SCAN_STATS_REPLY[3:]) == {
+        'scans': 100000,
+        'window': 1000,
+        'period_avg_us': 10,
+        'period_min': 8,
+        'period_max': 500,
+        'period_p50': 9,
+        'period_p90': 11,
+        'period_p99': 95,
+        'worst_task': 2,
+        'worst_task_time': 300,
+    }
+
+
+def test_command():
+    device = FakeDevice(SCAN_STATS_REPLY)
+    payload = scan_stats._command(device, scan_stats.ID_CUSTOM_GET_VALUE, scan_stats.ID_CUSTOM_CHANNEL, scan_stats.ID_QMK_SCAN_STATS)
+
+    assert device.written == [b'\0' + bytes([0x08, 0x00, 0xFE]).ljust(scan_stats.RAW_EPSIZE, b'\0')]
+    assert payload == SCAN_STATS_REPLY[3:]
+
+
+def test_command_unhandled():
+    device = FakeDevice(bytes([scan_stats.ID_UNHANDLED]).ljust(scan_stats.RAW_EPSIZE, b'\0'))
+    assert scan_stats._command(device, scan_stats.ID_CUSTOM_GET_VALUE, scan_stats.ID_CUSTOM_CHANNEL, scan_stats.ID_QMK_SCAN_STATS) is None
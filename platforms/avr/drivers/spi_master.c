@@ -171,6 +171,17 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    // No DMA available, so the data is sent straight away
+    return spi_transmit(data, length);
+}
+
+void spi_transmit_wait(void) {}
+
+bool spi_transmit_busy(void) {
+    return false;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
@@ -198,3 +209,8 @@ void spi_stop(void) {
         current_slave_2x     = false;
     }
 }
+
+void spi_stop_async(void) {
+    // Nothing is ever left in progress, so the transaction can end straight away
+    spi_stop();
+}
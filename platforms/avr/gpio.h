@@ -38,3 +38,9 @@ typedef uint8_t pin_t;
 #define gpio_read_pin(pin) ((bool)(PINx_ADDRESS(pin) & _BV((pin) & 0xF)))
 
 #define gpio_toggle_pin(pin) (PORTx_ADDRESS(pin) ^= _BV((pin) & 0xF))
+
+/* Operation of GPIO by port. */
+
+typedef uint8_t gpio_port_data_t;
+
+#define gpio_read_port(pin) (PINx_ADDRESS(pin))
@@ -59,7 +59,8 @@
 #    endif
 #endif
 
-static bool spiStarted = false;
+static bool spiStarted     = false;
+static bool spiStopPending = false; // spi_stop_async() was called while a transfer was still in progress
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
 static pin_t current_slave_pin     = NO_PIN;
 static bool  current_cs_active_low = true;
@@ -125,6 +126,11 @@ __attribute__((weak)) void spi_init(void) {
 }
 
 bool spi_start_extended(spi_start_config_t *start_config) {
+    // A transaction left to end once its transfer completes has to be finished off before the bus can be used again
+    if (spiStopPending) {
+        spi_stop();
+    }
+
 #if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
     spiAcquireBus(&SPI_DRIVER);
 #endif // (SPI_USE_MUTUAL_EXCLUSION == TRUE)
@@ -437,6 +443,8 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 }
 
 spi_status_t spi_write(uint8_t data) {
+    spi_transmit_wait();
+
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -444,6 +452,8 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_transmit_wait();
+
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -451,17 +461,53 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
+
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
+
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_transmit_wait(void) {
+    // Sleep until the end of transfer interrupt wakes the thread up, the same way spiSend() waits
+    osalSysLock();
+    if (SPI_DRIVER.state == SPI_ACTIVE) {
+        (void)osalThreadSuspendS(&SPI_DRIVER.thread);
+    }
+    osalSysUnlock();
+}
+
+bool spi_transmit_busy(void) {
+    // The end of transfer interrupt sets the driver back to ready, so the state has to be read from memory every time
+    if (*(volatile spistate_t *)&SPI_DRIVER.state == SPI_ACTIVE) {
+        return true;
+    }
+
+    // Release the bus as soon as the transfer is seen to have completed, rather than on the next spi_start()
+    if (spiStopPending) {
+        spi_stop();
+    }
+    return false;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
+
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
+    spiStopPending = false;
     if (spiStarted) {
+        spi_transmit_wait();
+
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
@@ -471,3 +517,12 @@ void spi_stop(void) {
     spiReleaseBus(&SPI_DRIVER);
 #endif // (SPI_USE_MUTUAL_EXCLUSION == TRUE)
 }
+
+void spi_stop_async(void) {
+    if (!spiStarted || !spi_transmit_busy()) {
+        spi_stop();
+        return;
+    }
+
+    spiStopPending = true;
+}
@@ -60,6 +60,10 @@
 #    define WS2812_PWM_TIMER_32BIT
 #endif
 
+#if defined(WS2812_PWM_DOUBLE_BUFFER) && (defined(WB32F3G71xx) || defined(WB32FQ95xx) || defined(AT32F415))
+#    error "WS2812_PWM_DOUBLE_BUFFER is currently only supported on STM32"
+#endif
+
 #ifndef WS2812_PWM_COMPLEMENTARY_OUTPUT
 #    define WS2812_PWM_OUTPUT_MODE PWM_OUTPUT_ACTIVE_HIGH
 #else
@@ -290,22 +294,63 @@ typedef uint8_t ws2812_buffer_t;
 typedef uint8_t ws2812_buffer_t;
 #endif
 
-static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+#    define WS2812_PWM_BUFFER_COUNT 2
+#else
+#    define WS2812_PWM_BUFFER_COUNT 1
+#endif
+
+static ws2812_buffer_t ws2812_frame_buffer[WS2812_PWM_BUFFER_COUNT][WS2812_BIT_N + 1]; /**< Buffers for a frame, DMA streams from the first one */
+
+/**
+ * @brief   The buffer ws2812_flush() encodes into
+ *
+ * Without double buffering this is the buffer DMA is streaming from, so a flush may tear the frame on the wire.
+ */
+static ws2812_buffer_t* ws2812_write_buffer = ws2812_frame_buffer[WS2812_PWM_BUFFER_COUNT - 1];
+
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+static volatile bool ws2812_swap_pending = false;
 
-/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
- * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
- * the memory (while the DMA is reading/writing from/to a buffer, the application can
- * write/read to/from the other buffer).
+ * Double-buffer type transactions: while DMA streams one buffer the application writes the other,
+ * and the buffers are swapped on transfer complete. The frame has just ended with its reset period
+ * at that point, so briefly stopping the stream only lengthens the reset.
  */
+static void ws2812_dma_cb(void* p, uint32_t flags) {
+    (void)p;
+
+    if ((flags & STM32_DMA_ISR_TCIF) && ws2812_swap_pending) {
+        osalSysLockFromISR();
+        ws2812_buffer_t* front = ws2812_write_buffer;
+        ws2812_write_buffer    = (front == ws2812_frame_buffer[0]) ? ws2812_frame_buffer[1] : ws2812_frame_buffer[0];
+        ws2812_swap_pending    = false;
+
+        dmaStreamDisable(WS2812_PWM_DMA_STREAM);
+        dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, front);
+        dmaStreamSetTransactionSize(WS2812_PWM_DMA_STREAM, WS2812_BIT_N);
+        dmaStreamEnable(WS2812_PWM_DMA_STREAM);
+        osalSysUnlockFromISR();
+    }
+}
+#    define WS2812_PWM_DMA_CB ws2812_dma_cb
+#    define WS2812_PWM_DMA_IRQ_MODE STM32_DMA_CR_TCIE
+#else
+#    define WS2812_PWM_DMA_CB NULL
+#    define WS2812_PWM_DMA_IRQ_MODE 0
+#endif
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
 void ws2812_init(void) {
-    // Initialize led frame buffer
-    uint32_t i;
-    for (i = 0; i < WS2812_COLOR_BIT_N; i++)
-        ws2812_frame_buffer[i] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
-    for (i = 0; i < WS2812_RESET_BIT_N; i++)
-        ws2812_frame_buffer[i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
+    // Initialize led frame buffers
+    for (uint8_t buf = 0; buf < WS2812_PWM_BUFFER_COUNT; buf++) {
+        uint32_t i;
+        for (i = 0; i < WS2812_COLOR_BIT_N; i++)
+            ws2812_frame_buffer[buf][i] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
+        for (i = 0; i < WS2812_RESET_BIT_N; i++)
+            ws2812_frame_buffer[buf][i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
+    }
 
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 
@@ -334,19 +379,19 @@ void ws2812_init(void) {
     // dmaInit(); // Joe added this
 #if defined(WB32F3G71xx) || defined(WB32FQ95xx)
     dmaStreamAlloc(WS2812_PWM_DMA_STREAM - WB32_DMA_STREAM(0), 10, NULL, NULL);
-    dmaStreamSetSource(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer);
+    dmaStreamSetSource(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer[0]);
     dmaStreamSetDestination(WS2812_PWM_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
     dmaStreamSetMode(WS2812_PWM_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_PWM_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_CIRC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3));
 #elif defined(AT32F415)
     dmaStreamAlloc(WS2812_PWM_DMA_STREAM - AT32_DMA_STREAM(0), 10, NULL, NULL);
     dmaStreamSetPeripheral(WS2812_PWM_DMA_STREAM, &(WS2812_PWM_DRIVER.tmr->CDT[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
-    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer);
+    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer[0]);
     dmaStreamSetMode(WS2812_PWM_DMA_STREAM, AT32_DMA_CCTRL_DTD_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | AT32_DMA_CCTRL_MINCM | AT32_DMA_CCTRL_LM | AT32_DMA_CCTRL_CHPL(3));
 #else
-    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - STM32_DMA_STREAM(0), 10, WS2812_PWM_DMA_CB, NULL);
     dmaStreamSetPeripheral(WS2812_PWM_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
-    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer);
-    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_PWM_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3));
+    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer[0]);
+    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_PWM_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3) | WS2812_PWM_DMA_IRQ_MODE);
 #endif
     dmaStreamSetTransactionSize(WS2812_PWM_DMA_STREAM, WS2812_BIT_N);
     // M2P: Memory 2 Periph; PL: Priority Level
@@ -375,19 +420,19 @@ void ws2812_init(void) {
 void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
     // Write color to frame buffer
     for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        ws2812_write_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        ws2812_write_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        ws2812_write_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
     }
 }
 void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
     // Write color to frame buffer
     for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        ws2812_write_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        ws2812_write_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        ws2812_write_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
 #ifdef WS2812_RGBW
-        ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        ws2812_write_buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
 #endif
     }
 }
@@ -410,6 +455,13 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+    // Keep the previous frame from being swapped in while the back buffer is rewritten
+    osalSysLock();
+    ws2812_swap_pending = false;
+    osalSysUnlock();
+#endif
+
     for (int i = 0; i < WS2812_LED_COUNT; i++) {
 #if defined(WS2812_RGBW)
         ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
@@ -417,4 +469,8 @@ void ws2812_flush(void) {
         ws2812_write_led(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b);
 #endif
     }
+
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+    ws2812_swap_pending = true;
+#endif
 }
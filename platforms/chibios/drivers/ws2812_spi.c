@@ -102,6 +102,10 @@
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE(WS2812_SPI_SCK_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL
 #endif
 
+#if defined(WS2812_SPI_DOUBLE_BUFFER) && defined(WS2812_SPI_USE_CIRCULAR_BUFFER)
+#    error "WS2812_SPI_DOUBLE_BUFFER cannot be combined with WS2812_SPI_USE_CIRCULAR_BUFFER"
+#endif
+
 #define BYTES_FOR_LED_BYTE 4
 #ifdef WS2812_RGBW
 #    define WS2812_CHANNELS 4
@@ -112,58 +116,88 @@
 #define DATA_SIZE (BYTES_FOR_LED * WS2812_LED_COUNT)
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+/*
+ * ws2812_flush() encodes into the buffer DMA is not reading from. If the bus
+ * is still busy the new frame is left pending, and the end-of-transfer
+ * callback swaps buffers and starts it, so flush never waits on the LEDs.
+ */
+static uint8_t       txbuf[2][TXBUF_SIZE] = {0};
+static uint8_t       tx_front             = 0;
+static volatile bool tx_busy              = false;
+static volatile bool tx_pending           = false;
+#else
+static uint8_t txbuf[1][TXBUF_SIZE] = {0};
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
+ * the ws2812b protocol, each data bit is expanded into 4 SPI bits: 0b1110 for
+ * a 1 and 0b1000 for a 0. This table holds the two output bytes for every
+ * nibble, so a color byte is encoded with two lookups.
  */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
+#define WS2812_SPI_BIT(b) ((b) ? 0b1110 : 0b1000)
+#define WS2812_SPI_NIBBLE(n) {(WS2812_SPI_BIT((n) & 8) << 4) | WS2812_SPI_BIT((n) & 4), (WS2812_SPI_BIT((n) & 2) << 4) | WS2812_SPI_BIT((n) & 1)}
+
+// clang-format off
+static const uint8_t ws2812_spi_nibble_lut[16][2] = {
+    WS2812_SPI_NIBBLE(0),  WS2812_SPI_NIBBLE(1),  WS2812_SPI_NIBBLE(2),  WS2812_SPI_NIBBLE(3),
+    WS2812_SPI_NIBBLE(4),  WS2812_SPI_NIBBLE(5),  WS2812_SPI_NIBBLE(6),  WS2812_SPI_NIBBLE(7),
+    WS2812_SPI_NIBBLE(8),  WS2812_SPI_NIBBLE(9),  WS2812_SPI_NIBBLE(10), WS2812_SPI_NIBBLE(11),
+    WS2812_SPI_NIBBLE(12), WS2812_SPI_NIBBLE(13), WS2812_SPI_NIBBLE(14), WS2812_SPI_NIBBLE(15),
+};
+// clang-format on
+
+static inline void encode_byte(uint8_t* dst, uint8_t data) {
+    const uint8_t* hi = ws2812_spi_nibble_lut[data >> 4];
+    const uint8_t* lo = ws2812_spi_nibble_lut[data & 0x0F];
+
+    dst[0] = hi[0];
+    dst[1] = hi[1];
+    dst[2] = lo[0];
+    dst[3] = lo[1];
 }
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static void set_led_color_rgb(uint8_t* buf, ws2812_led_t color, int pos) {
+    uint8_t* tx_start = &buf[PREAMBLE_SIZE + BYTES_FOR_LED * pos];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    encode_byte(tx_start, color.g);
+    encode_byte(tx_start + BYTES_FOR_LED_BYTE, color.r);
+    encode_byte(tx_start + BYTES_FOR_LED_BYTE * 2, color.b);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    encode_byte(tx_start, color.r);
+    encode_byte(tx_start + BYTES_FOR_LED_BYTE, color.g);
+    encode_byte(tx_start + BYTES_FOR_LED_BYTE * 2, color.b);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
+    encode_byte(tx_start, color.b);
+    encode_byte(tx_start + BYTES_FOR_LED_BYTE, color.g);
+    encode_byte(tx_start + BYTES_FOR_LED_BYTE * 2, color.r);
 #endif
 #ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
+    encode_byte(tx_start + BYTES_FOR_LED_BYTE * 3, color.w);
 #endif
 }
 
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+static void ws2812_spi_end_cb(SPIDriver* spip) {
+    osalSysLockFromISR();
+    if (tx_pending) {
+        tx_pending = false;
+        tx_front ^= 1;
+        spiStartSendI(spip, TXBUF_SIZE, txbuf[tx_front]);
+    } else {
+        tx_busy = false;
+    }
+    osalSysUnlockFromISR();
+}
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#else
+#    define WS2812_SPI_END_CB NULL
+#endif
+
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
 void ws2812_init(void) {
@@ -180,7 +214,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -198,7 +232,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -219,7 +253,7 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
 #endif
 }
 
@@ -239,17 +273,39 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+    // Any frame still waiting for the bus is superseded by this one
+    osalSysLock();
+    tx_pending   = false;
+    uint8_t back = tx_front ^ 1;
+    osalSysUnlock();
+
     for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+        set_led_color_rgb(txbuf[back], ws2812_leds[i], i);
+    }
+
+    osalSysLock();
+    if (tx_busy) {
+        tx_pending = true;
+    } else {
+        tx_busy  = true;
+        tx_front = back;
+        spiStartSendI(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[tx_front]);
+    }
+    osalSysUnlock();
+#else
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        set_led_color_rgb(txbuf[0], ws2812_leds[i], i);
     }
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
-#    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    // Instead spiSend can be used to send synchronously, or WS2812_SPI_DOUBLE_BUFFER enabled.
+#    ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+#        ifdef WS2812_SPI_SYNC
+    spiSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
+#        else
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
+#        endif
 #    endif
 #endif
 }
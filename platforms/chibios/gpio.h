@@ -43,3 +43,22 @@ typedef ioline_t pin_t;
 #define gpio_read_pin(pin) palReadLine(pin)
 
 #define gpio_toggle_pin(pin) palToggleLine(pin)
+
+/* Operation of GPIO by port. */
+
+typedef ioportmask_t gpio_port_data_t;
+
+#define gpio_read_port(pin) palReadPort(PAL_PORT(pin))
+
+/* Operation of GPIO interrupts, requires PAL_USE_CALLBACKS in halconf.h. */
+
+#if PAL_USE_CALLBACKS == TRUE
+#    define gpio_enable_pin_interrupt(pin, callback)                   \
+        do {                                                           \
+            palSetLineCallback((pin), (palcallback_t)(callback), NULL); \
+            palEnableLineEvent((pin), PAL_EVENT_MODE_BOTH_EDGES);      \
+        } while (0)
+#    define gpio_disable_pin_interrupt(pin) palDisableLineEvent(pin)
+/* Pins with the same pad number share one interrupt line (EXTI on STM32), only one of them can be enabled at a time. */
+#    define gpio_pin_interrupt_line(pin) PAL_PAD(pin)
+#endif
@@ -118,3 +118,16 @@ uint32_t timer_read32(void) {
 
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
+
+uint32_t timer_read_us(void) {
+#if (1000000 % CH_CFG_ST_FREQUENCY) == 0
+    syssts_t sts   = chSysGetStatusAndLockX();
+    uint32_t ticks = get_system_time_ticks();
+    chSysRestoreStatusX(sts);
+
+    // A tick is a whole number of microseconds, so the product wraps around together with the 32-bit tick counter
+    return ticks * (1000000 / CH_CFG_ST_FREQUENCY);
+#else
+    return timer_read32() * 1000;
+#endif
+}
@@ -0,0 +1,118 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gpio_mock.h"
+
+static mock_gpio_mode_t pin_mode[MOCK_GPIO_PIN_COUNT];
+static bool             pin_output[MOCK_GPIO_PIN_COUNT];
+static uint32_t         switches[MOCK_GPIO_PIN_COUNT][MOCK_GPIO_PORT_COUNT];
+static uint32_t         pin_reads;
+static uint32_t         port_reads;
+
+static mock_gpio_callback_t pin_callback[MOCK_GPIO_PIN_COUNT];
+static bool                 pin_callback_level[MOCK_GPIO_PIN_COUNT];
+
+static bool pin_level(pin_t pin);
+
+// Fires the callback of every enabled pin whose level changed
+static void update_interrupts(void) {
+    for (uint16_t pin = 0; pin < MOCK_GPIO_PIN_COUNT; pin++) {
+        if (pin_callback[pin]) {
+            bool level = pin_level(pin);
+            if (level != pin_callback_level[pin]) {
+                pin_callback_level[pin] = level;
+                pin_callback[pin](NULL);
+            }
+        }
+    }
+}
+
+void mock_gpio_reset(void) {
+    memset(pin_mode, 0, sizeof(pin_mode));
+    memset(pin_output, 0, sizeof(pin_output));
+    memset(switches, 0, sizeof(switches));
+    memset(pin_callback, 0, sizeof(pin_callback));
+    pin_reads  = 0;
+    port_reads = 0;
+}
+
+void mock_gpio_set_switch(pin_t a, pin_t b, bool closed) {
+    if (closed) {
+        switches[a][MOCK_PIN_PORT(b)] |= 1u << MOCK_PIN_BIT(b);
+        switches[b][MOCK_PIN_PORT(a)] |= 1u << MOCK_PIN_BIT(a);
+    } else {
+        switches[a][MOCK_PIN_PORT(b)] &= ~(1u << MOCK_PIN_BIT(b));
+        switches[b][MOCK_PIN_PORT(a)] &= ~(1u << MOCK_PIN_BIT(a));
+    }
+    update_interrupts();
+}
+
+void mock_gpio_set_mode(pin_t pin, mock_gpio_mode_t mode) {
+    pin_mode[pin] = mode;
+    update_interrupts();
+}
+
+mock_gpio_mode_t mock_gpio_get_mode(pin_t pin) {
+    return pin_mode[pin];
+}
+
+void mock_gpio_write(pin_t pin, bool level) {
+    pin_output[pin] = level;
+    update_interrupts();
+}
+
+void mock_gpio_enable_interrupt(pin_t pin, mock_gpio_callback_t callback) {
+    pin_callback[pin]       = callback;
+    pin_callback_level[pin] = pin_level(pin);
+}
+
+void mock_gpio_disable_interrupt(pin_t pin) {
+    pin_callback[pin] = NULL;
+}
+
+static bool pin_level(pin_t pin) {
+    if (pin_mode[pin] == MOCK_GPIO_MODE_OUTPUT) {
+        return pin_output[pin];
+    }
+
+    // A closed switch to a driven pin wins over the pull resistor
+    for (uint8_t port = 0; port < MOCK_GPIO_PORT_COUNT; port++) {
+        uint32_t connected = switches[pin][port];
+        while (connected) {
+            pin_t other = MOCK_PIN(port, __builtin_ctz(connected));
+            connected &= connected - 1;
+            if (pin_mode[other] == MOCK_GPIO_MODE_OUTPUT) {
+                return pin_output[other];
+            }
+        }
+    }
+
+    return pin_mode[pin] != MOCK_GPIO_MODE_INPUT_PULLDOWN;
+}
+
+bool mock_gpio_read(pin_t pin) {
+    pin_reads++;
+    return pin_level(pin);
+}
+
+gpio_port_data_t mock_gpio_read_port(pin_t pin) {
+    gpio_port_data_t data = 0;
+    uint8_t          port = MOCK_PIN_PORT(pin);
+
+    port_reads++;
+    for (uint8_t bit = 0; bit < 32; bit++) {
+        if (pin_level(MOCK_PIN(port, bit))) {
+            data |= 1u << bit;
+        }
+    }
+    return data;
+}
+
+uint32_t mock_gpio_pin_reads(void) {
+    return pin_reads;
+}
+
+uint32_t mock_gpio_port_reads(void) {
+    return port_reads;
+}
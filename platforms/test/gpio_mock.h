@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Mock GPIO backend for host tests.
+ *
+ * Pins live on MOCK_GPIO_PORT_COUNT 32-bit ports and are named with MOCK_PIN(port, bit). Inputs are pulled
+ * up, and read low when a closed switch connects them to an output driven low, so a test can wire up an
+ * arbitrary key matrix with mock_gpio_set_switch() and scan it through the regular GPIO API. Pin interrupts
+ * fire synchronously whenever a change to the mock alters the level of a pin they are enabled on, and like
+ * STM32 EXTI lines, pins with the same bit number share an interrupt line.
+ */
+
+typedef uint8_t  pin_t;
+typedef uint32_t gpio_port_data_t;
+
+#define MOCK_GPIO_PORT_COUNT 7
+#define MOCK_GPIO_PIN_COUNT (MOCK_GPIO_PORT_COUNT * 32)
+#define MOCK_PIN(port, bit) ((pin_t)(((port) << 5) | (bit)))
+#define MOCK_PIN_PORT(pin) ((pin) >> 5)
+#define MOCK_PIN_BIT(pin) ((pin) & 0x1F)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    MOCK_GPIO_MODE_INPUT,
+    MOCK_GPIO_MODE_INPUT_PULLUP,
+    MOCK_GPIO_MODE_INPUT_PULLDOWN,
+    MOCK_GPIO_MODE_OUTPUT,
+} mock_gpio_mode_t;
+
+typedef void (*mock_gpio_callback_t)(void *arg);
+
+void             mock_gpio_set_mode(pin_t pin, mock_gpio_mode_t mode);
+void             mock_gpio_write(pin_t pin, bool level);
+bool             mock_gpio_read(pin_t pin);
+gpio_port_data_t mock_gpio_read_port(pin_t pin);
+void             mock_gpio_enable_interrupt(pin_t pin, mock_gpio_callback_t callback);
+void             mock_gpio_disable_interrupt(pin_t pin);
+
+/* Test helpers */
+void             mock_gpio_reset(void);
+void             mock_gpio_set_switch(pin_t a, pin_t b, bool closed);
+mock_gpio_mode_t mock_gpio_get_mode(pin_t pin);
+uint32_t         mock_gpio_pin_reads(void);
+uint32_t         mock_gpio_port_reads(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define gpio_set_pin_input(pin) mock_gpio_set_mode((pin), MOCK_GPIO_MODE_INPUT)
+#define gpio_set_pin_input_high(pin) mock_gpio_set_mode((pin), MOCK_GPIO_MODE_INPUT_PULLUP)
+#define gpio_set_pin_input_low(pin) mock_gpio_set_mode((pin), MOCK_GPIO_MODE_INPUT_PULLDOWN)
+#define gpio_set_pin_output_push_pull(pin) mock_gpio_set_mode((pin), MOCK_GPIO_MODE_OUTPUT)
+#define gpio_set_pin_output_open_drain(pin) mock_gpio_set_mode((pin), MOCK_GPIO_MODE_OUTPUT)
+#define gpio_set_pin_output(pin) gpio_set_pin_output_push_pull(pin)
+
+#define gpio_write_pin_high(pin) mock_gpio_write((pin), true)
+#define gpio_write_pin_low(pin) mock_gpio_write((pin), false)
+#define gpio_write_pin(pin, level) mock_gpio_write((pin), (level))
+
+#define gpio_read_pin(pin) mock_gpio_read(pin)
+
+#define gpio_toggle_pin(pin) mock_gpio_write((pin), !mock_gpio_read(pin))
+
+#define gpio_read_port(pin) mock_gpio_read_port(pin)
+
+#define gpio_enable_pin_interrupt(pin, callback) mock_gpio_enable_interrupt((pin), (callback))
+#define gpio_disable_pin_interrupt(pin) mock_gpio_disable_interrupt(pin)
+#define gpio_pin_interrupt_line(pin) MOCK_PIN_BIT(pin)
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gpio_mock.h"
+
+#define MATRIX_ROWS 3
+#define MATRIX_COLS 4
+#define DIODE_DIRECTION COL2ROW
+#define MATRIX_IDLE_TIMEOUT 1000
+
+#define MATRIX_ROW_PINS { MOCK_PIN(0, 0), MOCK_PIN(0, 1), MOCK_PIN(0, 2) }
+#define MATRIX_COL_PINS { MOCK_PIN(1, 0), NO_PIN, MOCK_PIN(1, 5), MOCK_PIN(2, 3) }
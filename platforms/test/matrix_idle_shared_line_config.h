@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gpio_mock.h"
+
+#define MATRIX_ROWS 3
+#define MATRIX_COLS 4
+#define DIODE_DIRECTION COL2ROW
+#define MATRIX_IDLE_TIMEOUT 1000
+
+// The first and last columns are on the same interrupt line
+#define MATRIX_ROW_PINS { MOCK_PIN(0, 0), MOCK_PIN(0, 1), MOCK_PIN(0, 2) }
+#define MATRIX_COL_PINS { MOCK_PIN(1, 3), NO_PIN, MOCK_PIN(1, 5), MOCK_PIN(2, 3) }
+
+#define MATRIX_IDLE_TEST_SHARED_LINE
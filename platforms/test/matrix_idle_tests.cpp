@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "gpio_mock.h"
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+void matrix_init_kb(void) {}
+void matrix_scan_kb(void) {}
+void matrix_output_select_delay(void) {}
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+
+static int wakeups = 0;
+
+void matrix_idle_wakeup(void) {
+    wakeups++;
+}
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class MatrixIdle : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_gpio_reset();
+        matrix_init();
+        wakeups = 0;
+    }
+
+    void press(uint8_t row, uint8_t col, bool pressed) {
+        mock_gpio_set_switch(row_pins[row], col_pins[col], pressed);
+    }
+};
+
+#ifdef MATRIX_IDLE_TEST_SHARED_LINE
+TEST_F(MatrixIdle, SharedInterruptLineRefuses) {
+    EXPECT_FALSE(matrix_idle_arm());
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(mock_gpio_get_mode(row_pins[row]), MOCK_GPIO_MODE_INPUT_PULLUP);
+    }
+
+    press(0, 0, true);
+    EXPECT_EQ(wakeups, 0);
+    matrix_scan();
+    EXPECT_EQ(matrix[0], 1);
+}
+#else
+TEST_F(MatrixIdle, ArmSelectsEveryRow) {
+    ASSERT_TRUE(matrix_idle_arm());
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(mock_gpio_get_mode(row_pins[row]), MOCK_GPIO_MODE_OUTPUT);
+        EXPECT_FALSE(mock_gpio_read(row_pins[row]));
+    }
+
+    matrix_idle_disarm();
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(mock_gpio_get_mode(row_pins[row]), MOCK_GPIO_MODE_INPUT_PULLUP);
+    }
+}
+
+TEST_F(MatrixIdle, EveryKeyWakes) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (col_pins[col] == NO_PIN) continue;
+
+            ASSERT_TRUE(matrix_idle_arm());
+            wakeups = 0;
+            press(row, col, true);
+            EXPECT_EQ(wakeups, 1) << "key " << (int)row << "," << (int)col;
+
+            // The first scan after waking sees the key that woke the matrix
+            matrix_idle_disarm();
+            matrix_scan();
+            EXPECT_EQ(matrix[row], (matrix_row_t)1 << col) << "key " << (int)row << "," << (int)col;
+
+            press(row, col, false);
+            matrix_scan();
+            EXPECT_EQ(matrix[row], 0);
+        }
+    }
+}
+
+TEST_F(MatrixIdle, KeyHeldWhileArmingRefuses) {
+    press(2, 3, true);
+    EXPECT_FALSE(matrix_idle_arm());
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(mock_gpio_get_mode(row_pins[row]), MOCK_GPIO_MODE_INPUT_PULLUP);
+    }
+
+    matrix_scan();
+    EXPECT_EQ(matrix[2], (matrix_row_t)1 << 3);
+}
+
+TEST_F(MatrixIdle, DisarmStopsInterrupts) {
+    ASSERT_TRUE(matrix_idle_arm());
+    matrix_idle_disarm();
+    wakeups = 0;
+
+    press(0, 0, true);
+    matrix_scan();
+    press(0, 0, false);
+    matrix_scan();
+    EXPECT_EQ(wakeups, 0);
+}
+#endif
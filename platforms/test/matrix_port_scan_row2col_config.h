@@ -0,0 +1,30 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gpio_mock.h"
+
+#define A0 MOCK_PIN(0, 0)
+#define A1 MOCK_PIN(0, 1)
+#define A2 MOCK_PIN(0, 2)
+#define B3 MOCK_PIN(1, 3)
+#define B4 MOCK_PIN(1, 4)
+#define B5 MOCK_PIN(1, 5)
+#define B12 MOCK_PIN(1, 12)
+#define C6 MOCK_PIN(2, 6)
+#define C7 MOCK_PIN(2, 7)
+#define D0 MOCK_PIN(3, 0)
+#define D1 MOCK_PIN(3, 1)
+#define E5 MOCK_PIN(4, 5)
+
+#define MATRIX_ROWS 6
+#define MATRIX_COLS 6
+#define DIODE_DIRECTION ROW2COL
+#define MATRIX_PORT_SCAN
+
+// As emitted by `qmk generate-config-h` for these pins
+#define MATRIX_ROW_PINS { C7, C6, B12, A2, A1, A0 }
+#define MATRIX_COL_PINS { D0, D1, E5, B3, B4, B5 }
+#define MATRIX_ROW_PORTS { C7, B12, A2 }
+#define MATRIX_ROW_PORT_RUNS { {0, 7, 0x1, 0}, {0, 6, 0x1, 1}, {1, 12, 0x1, 2}, {2, 2, 0x1, 3}, {2, 1, 0x1, 4}, {2, 0, 0x1, 5} }
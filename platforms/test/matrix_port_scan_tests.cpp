@@ -0,0 +1,94 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "gpio_mock.h"
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+void matrix_init_kb(void) {}
+void matrix_scan_kb(void) {}
+void matrix_output_select_delay(void) {}
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+#if (DIODE_DIRECTION == COL2ROW)
+static const pin_t input_ports[] = MATRIX_COL_PORTS;
+#    define SCAN_LINES MATRIX_ROWS
+#else
+static const pin_t input_ports[] = MATRIX_ROW_PORTS;
+#    define SCAN_LINES MATRIX_COLS
+#endif
+
+class MatrixPortScan : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_gpio_reset();
+        matrix_init();
+    }
+
+    void press(uint8_t row, uint8_t col, bool pressed) {
+        mock_gpio_set_switch(row_pins[row], col_pins[col], pressed);
+    }
+};
+
+TEST_F(MatrixPortScan, EachKeyMapsToItsBit) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (row_pins[row] == NO_PIN || col_pins[col] == NO_PIN) continue;
+
+            press(row, col, true);
+            matrix_scan();
+            for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+                EXPECT_EQ(matrix[r], r == row ? (matrix_row_t)(1 << col) : 0) << "key " << (int)row << "," << (int)col << " row " << (int)r;
+            }
+
+            press(row, col, false);
+            matrix_scan();
+            for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+                EXPECT_EQ(matrix[r], 0) << "key " << (int)row << "," << (int)col << " released";
+            }
+        }
+    }
+}
+
+TEST_F(MatrixPortScan, FullLine) {
+    // Every key sharing one scan line, which cannot ghost without diodes in the mock
+#if (DIODE_DIRECTION == COL2ROW)
+    matrix_row_t expected = 0;
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] == NO_PIN) continue;
+        press(1, col, true);
+        expected |= (matrix_row_t)1 << col;
+    }
+    matrix_scan();
+    EXPECT_EQ(matrix[0], 0);
+    EXPECT_EQ(matrix[1], expected);
+    EXPECT_EQ(matrix[2], 0);
+#else
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        press(row, 2, true);
+    }
+    matrix_scan();
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(matrix[row], (matrix_row_t)1 << 2);
+    }
+#endif
+}
+
+TEST_F(MatrixPortScan, ReadsEachPortOncePerLine) {
+    uint32_t pin_reads  = mock_gpio_pin_reads();
+    uint32_t port_reads = mock_gpio_port_reads();
+
+    matrix_scan();
+
+    EXPECT_EQ(mock_gpio_pin_reads() - pin_reads, 0);
+    EXPECT_EQ(mock_gpio_port_reads() - port_reads, SCAN_LINES * (sizeof(input_ports) / sizeof(input_ports[0])));
+}
@@ -23,3 +23,33 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+matrix_port_scan_col2row_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_port_scan_col2row_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_port_scan_col2row_config.h
+matrix_port_scan_col2row_INC := $(PLATFORM_PATH)/$(PLATFORM_KEY)
+
+matrix_port_scan_col2row_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_port_scan_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/gpio_mock.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_port_scan_row2col_DEFS := $(matrix_port_scan_col2row_DEFS)
+matrix_port_scan_row2col_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_port_scan_row2col_config.h
+matrix_port_scan_row2col_INC := $(matrix_port_scan_col2row_INC)
+matrix_port_scan_row2col_SRC := $(matrix_port_scan_col2row_SRC)
+
+matrix_idle_gpio_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_idle_gpio_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_idle_config.h
+matrix_idle_gpio_INC := $(PLATFORM_PATH)/$(PLATFORM_KEY)
+
+matrix_idle_gpio_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_idle_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/gpio_mock.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_idle_shared_line_DEFS := $(matrix_idle_gpio_DEFS)
+matrix_idle_shared_line_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_idle_shared_line_config.h
+matrix_idle_shared_line_INC := $(matrix_idle_gpio_INC)
+matrix_idle_shared_line_SRC := $(matrix_idle_gpio_SRC)
@@ -1 +1,2 @@
 TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+TEST_LIST += matrix_port_scan_col2row matrix_port_scan_row2col matrix_idle_gpio matrix_idle_shared_line
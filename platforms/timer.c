@@ -14,3 +14,12 @@ uint16_t timer_elapsed(uint16_t last) {
 uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(timer_read32(), last);
 }
+
+// Platforms with a finer clock provide their own
+__attribute__((weak)) uint32_t timer_read_us(void) {
+    return timer_read32() * 1000;
+}
+
+uint32_t timer_elapsed_us(uint32_t last) {
+    return TIMER_DIFF_32(timer_read_us(), last);
+}
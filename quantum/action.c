@@ -289,6 +289,9 @@ void process_record(keyrecord_t *record) {
 #ifdef FLOW_TAP_TERM
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
+#ifdef LATENCY_TRACE_ENABLE
+    latency_sample_t outer_sample = latency_trace_begin(record);
+#endif // LATENCY_TRACE_ENABLE
 
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
@@ -296,11 +299,14 @@ void process_record(keyrecord_t *record) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
         }
 #endif
-        return;
+    } else {
+        process_record_handler(record);
+        post_process_record_quantum(record);
     }
 
-    process_record_handler(record);
-    post_process_record_quantum(record);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_end(outer_sample);
+#endif // LATENCY_TRACE_ENABLE
 }
 
 void process_record_handler(keyrecord_t *record) {
@@ -5,6 +5,7 @@
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "debug.h"
 #include "keycode.h"
 #include "keycode_config.h"
 #include "quantum_keycodes.h"
@@ -127,10 +128,19 @@ static bool     flow_tap_expired      = true;
 static bool flow_tap_key_if_within_term(keyrecord_t *record, uint16_t prev_time);
 #    endif // defined(FLOW_TAP_TERM)
 
+STATIC_ASSERT(WAITING_BUFFER_SIZE >= 2 && WAITING_BUFFER_SIZE <= 255, "WAITING_BUFFER_SIZE must be between 2 and 255");
+
 static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
+static uint8_t     waiting_buffer_high_water           = 0;
+static uint16_t    waiting_buffer_overflows            = 0;
+
+// Advances a waiting buffer index, without a division when WAITING_BUFFER_SIZE isn't a power of two.
+static inline uint8_t waiting_buffer_next(uint8_t i) {
+    return (i + 1 == WAITING_BUFFER_SIZE) ? 0 : i + 1;
+}
 
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
@@ -163,6 +173,10 @@ void action_tapping_process(keyrecord_t record) {
         if (!waiting_buffer_enq(record)) {
             // clear all in case of overflow.
             ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
+            if (waiting_buffer_overflows < UINT16_MAX) {
+                waiting_buffer_overflows++;
+            }
+            dprintf("waiting buffer overflow #%u, consider increasing WAITING_BUFFER_SIZE\n", waiting_buffer_overflows);
             clear_keyboard();
             waiting_buffer_clear();
             tapping_key = (keyrecord_t){0};
@@ -179,7 +193,7 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail)) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
@@ -323,7 +337,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     // Now that tapping_key has settled as tapped, check whether
                     // Flow Tap applies to following yet-unsettled keys.
                     uint16_t prev_time = tapping_key.event.time;
-                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail)) {
                         keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
                         if (!record->event.pressed) {
                             break;
@@ -383,7 +397,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail)) {
                             ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
                             process_record(&waiting_buffer[waiting_buffer_tail]);
                         }
@@ -483,7 +497,7 @@ bool process_tapping(keyrecord_t *keyp) {
                                 if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
                                     tapping_key = waiting_buffer[waiting_buffer_tail];
                                     // Pop tail from the queue.
-                                    waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                    waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail);
                                     debug_waiting_buffer();
                                 } else
 #    endif // CHORDAL_HOLD
@@ -659,13 +673,19 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if (waiting_buffer_next(waiting_buffer_head) == waiting_buffer_tail) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
 
     waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    waiting_buffer_head                 = waiting_buffer_next(waiting_buffer_head);
+
+    uint8_t used = waiting_buffer_head >= waiting_buffer_tail ? waiting_buffer_head - waiting_buffer_tail : waiting_buffer_head + WAITING_BUFFER_SIZE - waiting_buffer_tail;
+    if (used > waiting_buffer_high_water) {
+        waiting_buffer_high_water = used;
+        dprintf("waiting buffer high water: %u/%u\n", used, WAITING_BUFFER_SIZE - 1);
+    }
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
@@ -681,12 +701,25 @@ void waiting_buffer_clear(void) {
     waiting_buffer_tail = 0;
 }
 
+uint8_t waiting_buffer_get_high_water(void) {
+    return waiting_buffer_high_water;
+}
+
+uint16_t waiting_buffer_get_overflows(void) {
+    return waiting_buffer_overflows;
+}
+
+void waiting_buffer_reset_stats(void) {
+    waiting_buffer_high_water = 0;
+    waiting_buffer_overflows  = 0;
+}
+
 /** \brief Waiting buffer typed
  *
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
         }
@@ -699,7 +732,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         if (waiting_buffer[i].event.pressed) return true;
     }
     return false;
@@ -720,7 +753,7 @@ void waiting_buffer_scan_tap(void) {
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         keyrecord_t *candidate = &waiting_buffer[i];
         // clang-format off
         if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && (
@@ -786,7 +819,7 @@ static void speculative_key_press(keyrecord_t *record) {
 
     // Don't do Speculative Hold when there are non-speculated buffered events,
     // since that could result in sending keys out of order.
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         if (!waiting_buffer[i].tap.speculated) {
             return;
         }
@@ -945,7 +978,7 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
     keyrecord_t *prev         = &tapping_key;
     uint16_t     prev_keycode = get_record_keycode(&tapping_key, false);
     uint8_t      first_tap    = WAITING_BUFFER_SIZE;
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         keyrecord_t   *cur         = &waiting_buffer[i];
         const uint16_t cur_keycode = get_record_keycode(cur, false);
         if (!cur->event.pressed || !is_mt_or_lt(prev_keycode)) {
@@ -968,7 +1001,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail);
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -977,7 +1010,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail)) {
         if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
             break; // Stop once a tap-hold key event is reached.
         }
@@ -1099,7 +1132,7 @@ static void debug_tapping_key(void) {
 /** \brief Logs waiting buffer if ACTION_DEBUG is enabled. */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         ac_dprintf(" [%u]=", i);
         debug_record(waiting_buffer[i]);
     }
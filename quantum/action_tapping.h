@@ -32,12 +32,24 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define TAPPING_TOGGLE 5
 #endif
 
-#define WAITING_BUFFER_SIZE 8
+/* number of events held back while a tap-hold key is undecided */
+#ifndef WAITING_BUFFER_SIZE
+#    define WAITING_BUFFER_SIZE 8
+#endif
 
 #ifndef NO_ACTION_TAPPING
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
 uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache);
 void     action_tapping_process(keyrecord_t record);
+
+/** Gets the largest number of events the waiting buffer has held at once. */
+uint8_t waiting_buffer_get_high_water(void);
+
+/** Gets the number of times the waiting buffer overflowed, dropping all pending events. */
+uint16_t waiting_buffer_get_overflows(void);
+
+/** Resets the waiting buffer high water mark and overflow count. */
+void waiting_buffer_reset_stats(void);
 #endif
 
 uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record);
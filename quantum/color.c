@@ -108,3 +108,128 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+// clang-format off
+
+// Precomputed `h * 6 / 255` (with region 6 folded into 0) and the matching
+// `(h * 2 - region * 85) * 3` remainder, so the span path avoids a division per pixel.
+static const uint8_t hsv_hue_region[256] PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+};
+
+static const uint8_t hsv_hue_remainder[256] PROGMEM = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90,
+    96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156, 162, 168, 174, 180, 186,
+    192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252, 3, 9, 15, 21, 27,
+    33, 39, 45, 51, 57, 63, 69, 75, 81, 87, 93, 99, 105, 111, 117, 123,
+    129, 135, 141, 147, 153, 159, 165, 171, 177, 183, 189, 195, 201, 207, 213, 219,
+    225, 231, 237, 243, 249, 0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60,
+    66, 72, 78, 84, 90, 96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156,
+    162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252,
+    3, 9, 15, 21, 27, 33, 39, 45, 51, 57, 63, 69, 75, 81, 87, 93,
+    99, 105, 111, 117, 123, 129, 135, 141, 147, 153, 159, 165, 171, 177, 183, 189,
+    195, 201, 207, 213, 219, 225, 231, 237, 243, 249, 0, 6, 12, 18, 24, 30,
+    36, 42, 48, 54, 60, 66, 72, 78, 84, 90, 96, 102, 108, 114, 120, 126,
+    132, 138, 144, 150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222,
+    228, 234, 240, 246, 252, 3, 9, 15, 21, 27, 33, 39, 45, 51, 57, 63,
+    69, 75, 81, 87, 93, 99, 105, 111, 117, 123, 129, 135, 141, 147, 153, 159,
+    165, 171, 177, 183, 189, 195, 201, 207, 213, 219, 225, 231, 237, 243, 249, 0,
+};
+
+// clang-format on
+
+static void hsv_to_rgb_span_impl(const hsv_t *hsv, rgb_t *rgb, uint16_t count, bool use_cie) {
+    for (uint16_t i = 0; i < count; i++) {
+        // Neighbouring pixels frequently share a colour (solid fills, unlit LEDs)
+        if (i > 0 && hsv[i].h == hsv[i - 1].h && hsv[i].s == hsv[i - 1].s && hsv[i].v == hsv[i - 1].v) {
+            rgb[i] = rgb[i - 1];
+            continue;
+        }
+
+        uint8_t v = hsv[i].v;
+#ifdef USE_CIE1931_CURVE
+        if (use_cie) {
+            v = pgm_read_byte(&CIE1931_CURVE[v]);
+        }
+#else
+        (void)use_cie;
+#endif
+
+        uint8_t s = hsv[i].s;
+        if (s == 0) {
+            rgb[i].r = rgb[i].g = rgb[i].b = v;
+            continue;
+        }
+
+        uint8_t region    = pgm_read_byte(&hsv_hue_region[hsv[i].h]);
+        uint8_t remainder = pgm_read_byte(&hsv_hue_remainder[hsv[i].h]);
+
+        // q and t are evaluated together as two 16-bit lanes of one 32-bit word:
+        // lane 0 carries the `remainder` term, lane 1 the `255 - remainder` term.
+        uint32_t st = (uint32_t)s * ((uint32_t)remainder | ((uint32_t)(255 - remainder) << 16));
+        uint32_t qt = (uint32_t)v * (0x00FF00FFUL - ((st >> 8) & 0x00FF00FFUL));
+        uint8_t  q  = qt >> 8;
+        uint8_t  t  = qt >> 24;
+        uint8_t  p  = ((uint16_t)v * (255 - s)) >> 8;
+
+        switch (region) {
+            case 0:
+                rgb[i].r = v;
+                rgb[i].g = t;
+                rgb[i].b = p;
+                break;
+            case 1:
+                rgb[i].r = q;
+                rgb[i].g = v;
+                rgb[i].b = p;
+                break;
+            case 2:
+                rgb[i].r = p;
+                rgb[i].g = v;
+                rgb[i].b = t;
+                break;
+            case 3:
+                rgb[i].r = p;
+                rgb[i].g = q;
+                rgb[i].b = v;
+                break;
+            case 4:
+                rgb[i].r = t;
+                rgb[i].g = p;
+                rgb[i].b = v;
+                break;
+            default:
+                rgb[i].r = v;
+                rgb[i].g = p;
+                rgb[i].b = q;
+                break;
+        }
+    }
+}
+
+void hsv_to_rgb_span(const hsv_t *hsv, rgb_t *rgb, uint16_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_span_impl(hsv, rgb, count, true);
+#else
+    hsv_to_rgb_span_impl(hsv, rgb, count, false);
+#endif
+}
+
+void hsv_to_rgb_span_nocie(const hsv_t *hsv, rgb_t *rgb, uint16_t count) {
+    hsv_to_rgb_span_impl(hsv, rgb, count, false);
+}
@@ -95,3 +95,16 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+/**
+ * \brief Convert a run of HSV values to RGB in one pass.
+ *
+ * Produces exactly the same output as calling `hsv_to_rgb()` for each element,
+ * but uses lookup tables instead of a per-pixel division.
+ *
+ * \param hsv Input colors
+ * \param rgb Output colors, may not alias `hsv`
+ * \param count Number of elements in both arrays
+ */
+void hsv_to_rgb_span(const hsv_t *hsv, rgb_t *rgb, uint16_t count);
+void hsv_to_rgb_span_nocie(const hsv_t *hsv, rgb_t *rgb, uint16_t count);
@@ -4,39 +4,126 @@
 #include <stddef.h>
 #include <timer.h>
 #include <deferred_exec.h>
+#include "compiler_support.h"
 
 #ifndef MAX_DEFERRED_EXECUTORS
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+STATIC_ASSERT(MAX_DEFERRED_EXECUTORS <= 255, "MAX_DEFERRED_EXECUTORS must be 255 or less");
+
 //------------------------------------
 // Helpers
 //
+// Each table is a binary min-heap ordered by trigger time, kept in-place inside the caller's storage. The heap is a
+// permutation of table indices: positions below heap_count hold pending executors, the remaining positions hold free
+// slots, so claiming a slot is O(1) and scheduling/cancelling are O(log n). Permutation entries are XOR'ed with their
+// own index so that a zero-initialised table is the identity permutation.
+//
+// Tokens encode the slot they refer to -- token = 1 + slot + generation * table_count -- so lookups are O(1), and the
+// generation is bumped each time a slot is reused so stale tokens don't match the new occupant.
 
-static deferred_token current_token = 0;
+static inline uint8_t get_heap_slot(deferred_executor_t *table, uint8_t pos) {
+    return table[pos].heap_slot ^ pos;
+}
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
-    }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+static inline void set_heap_slot(deferred_executor_t *table, uint8_t pos, uint8_t slot) {
+    table[pos].heap_slot = slot ^ pos;
+}
+
+static inline uint8_t get_heap_pos(deferred_executor_t *table, uint8_t slot) {
+    return table[slot].heap_pos ^ slot;
+}
+
+static inline void set_heap_pos(deferred_executor_t *table, uint8_t slot, uint8_t pos) {
+    table[slot].heap_pos = pos ^ slot;
+}
+
+static inline bool trigger_before(deferred_executor_t *table, uint8_t pos_a, uint8_t pos_b) {
+    return ((int32_t)TIMER_DIFF_32(table[get_heap_slot(table, pos_a)].trigger_time, table[get_heap_slot(table, pos_b)].trigger_time)) < 0;
+}
+
+static void heap_swap(deferred_executor_t *table, uint8_t pos_a, uint8_t pos_b) {
+    uint8_t slot_a = get_heap_slot(table, pos_a);
+    uint8_t slot_b = get_heap_slot(table, pos_b);
+    set_heap_slot(table, pos_a, slot_b);
+    set_heap_slot(table, pos_b, slot_a);
+    set_heap_pos(table, slot_b, pos_a);
+    set_heap_pos(table, slot_a, pos_b);
+}
+
+static uint8_t heap_sift_up(deferred_executor_t *table, uint8_t pos) {
+    while (pos > 0) {
+        uint8_t parent = (pos - 1) / 2;
+        if (!trigger_before(table, pos, parent)) {
+            break;
         }
+        heap_swap(table, pos, parent);
+        pos = parent;
     }
-    return true;
+    return pos;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void heap_sift_down(deferred_executor_t *table, uint8_t pos) {
+    uint8_t count = table[0].heap_count;
+    while (true) {
+        uint16_t child = 2 * (uint16_t)pos + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && trigger_before(table, child + 1, child)) {
+            ++child;
         }
+        if (!trigger_before(table, child, pos)) {
+            break;
+        }
+        heap_swap(table, pos, child);
+        pos = child;
+    }
+}
+
+static inline void heap_update(deferred_executor_t *table, uint8_t pos) {
+    if (heap_sift_up(table, pos) == pos) {
+        heap_sift_down(table, pos);
     }
-    return current_token;
+}
+
+static void heap_remove(deferred_executor_t *table, uint8_t slot) {
+    uint8_t pos  = get_heap_pos(table, slot);
+    uint8_t last = table[0].heap_count - 1;
+
+    // Move the removed slot into the free region and fix up whichever executor took its place
+    heap_swap(table, pos, last);
+    table[0].heap_count = last;
+    if (pos < last) {
+        heap_update(table, pos);
+    }
+
+    // Leave the token in place so the next occupant of this slot gets a new generation
+    deferred_executor_t *entry = &table[slot];
+    entry->trigger_time        = 0;
+    entry->callback            = NULL;
+    entry->cb_arg              = NULL;
+}
+
+static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count, uint8_t slot) {
+    deferred_token prev = table[slot].token;
+    if (prev == INVALID_DEFERRED_TOKEN || (uint16_t)prev + table_count > UINT8_MAX) {
+        return slot + 1;
+    }
+    return prev + table_count;
+}
+
+static inline int16_t find_slot(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    if (!table || table_count == 0 || table_count > UINT8_MAX || token == INVALID_DEFERRED_TOKEN) {
+        return -1;
+    }
+
+    uint8_t slot = (token - 1) % table_count;
+    if (table[slot].token != token || get_heap_pos(table, slot) >= table[0].heap_count) {
+        return -1;
+    }
+    return slot;
 }
 
 //------------------------------------
@@ -45,74 +132,67 @@ static inline deferred_token allocate_token(deferred_executor_t *table, size_t t
 
 deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || !callback) {
+    if (!table || table_count == 0 || table_count > UINT8_MAX || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return INVALID_DEFERRED_TOKEN;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // The first position past the end of the heap always holds a free slot, unless everything is already allocated
+    uint8_t pos = table[0].heap_count;
+    if (pos >= table_count) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry
+    uint8_t              slot  = get_heap_slot(table, pos);
+    deferred_executor_t *entry = &table[slot];
+    entry->token               = allocate_token(table, table_count, slot);
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+
+    // Append to the heap and restore ordering
+    table[0].heap_count = pos + 1;
+    heap_sift_up(table, pos);
+    return entry->token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
-    // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
+    // Ignore queueing if it's a zero-time delay
+    if (delay_ms == 0) {
         return false;
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    int16_t slot = find_slot(table, table_count, token);
+    if (slot < 0) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[slot].trigger_time = timer_read32() + delay_ms;
+    heap_update(table, get_heap_pos(table, slot));
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    // Ignore request if the table/token are not valid
-    if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
+    // Find the entry corresponding to the token
+    int16_t slot = find_slot(table, table_count, token);
+    if (slot < 0) {
         return false;
     }
 
-    // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    // Found it, cancel and clear the table entry
+    heap_remove(table, slot);
+    return true;
+}
+
+bool deferred_exec_next_trigger_time_advanced(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    if (!table || table_count == 0 || table_count > UINT8_MAX || table[0].heap_count == 0) {
+        return false;
     }
 
-    // Not found
-    return false;
+    *trigger_time = table[get_heap_slot(table, 0)].trigger_time;
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +202,42 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        if (!table || table_count == 0 || table_count > UINT8_MAX) {
+            return;
+        }
+
+        // Run through the due executors in trigger order, invoking each at most as many times as there were pending
+        // executors -- a repeating executor that has fallen behind shouldn't be able to starve the main loop
+        for (uint8_t remaining = table[0].heap_count; remaining > 0 && table[0].heap_count > 0; --remaining) {
+            uint8_t              slot       = get_heap_slot(table, 0);
+            deferred_executor_t *entry      = &table[slot];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            // Earliest executor isn't due yet, so neither is anything else
+            if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // If the token has changed or the entry is no longer pending, then the callback has canceled and possibly
+            // re-queued. Skip further processing.
+            if (entry->token != curr_token || get_heap_pos(table, slot) >= table[0].heap_count) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+                heap_update(table, get_heap_pos(table, slot));
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                heap_remove(table, slot);
             }
         }
     }
@@ -172,6 +259,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+bool deferred_exec_next_trigger_time(uint32_t *trigger_time) {
+    return deferred_exec_next_trigger_time_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, trigger_time);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
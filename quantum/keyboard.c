@@ -33,6 +33,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "eeconfig.h"
 #include "action_layer.h"
 #include "suspend.h"
+#include "scan_stats.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -81,6 +82,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef KEY_OVERRIDE_ENABLE
 #    include "process_key_override.h"
 #endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+#if defined(MATRIX_IDLE_TIMEOUT) && defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
 #ifdef SECURE_ENABLE
 #    include "secure.h"
 #endif
@@ -199,33 +209,6 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
     last_input_modification_time           = MAX(matrix_timestamp, MAX(encoder_timestamp, pointing_device_timestamp));
 }
 
-// Only enable this if console is enabled to print to
-#if defined(DEBUG_MATRIX_SCAN_RATE)
-static uint32_t matrix_timer           = 0;
-static uint32_t matrix_scan_count      = 0;
-static uint32_t last_matrix_scan_count = 0;
-
-void matrix_scan_perf_task(void) {
-    matrix_scan_count++;
-
-    uint32_t timer_now = timer_read32();
-    if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
-#    if defined(CONSOLE_ENABLE)
-        dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
-#    endif
-        last_matrix_scan_count = matrix_scan_count;
-        matrix_timer           = timer_now;
-        matrix_scan_count      = 0;
-    }
-}
-
-uint32_t get_matrix_scan_rate(void) {
-    return last_matrix_scan_count;
-}
-#else
-#    define matrix_scan_perf_task()
-#endif
-
 #ifdef MATRIX_HAS_GHOST
 static matrix_row_t get_real_keys(uint8_t row, matrix_row_t rowdata) {
     matrix_row_t out = 0;
@@ -581,6 +564,113 @@ static inline void generate_tick_event(void) {
 
 matrix_row_t matrix_previous[MATRIX_ROWS];
 
+#ifdef MATRIX_IDLE_TIMEOUT
+#    ifdef SPLIT_KEYBOARD
+#        error "MATRIX_IDLE_TIMEOUT is not supported on split keyboards"
+#    endif
+
+static bool          matrix_idle       = false;
+static volatile bool matrix_idle_woken = false;
+#    ifdef PROTOCOL_CHIBIOS
+static thread_reference_t matrix_idle_sleeper = NULL;
+#    endif
+
+void matrix_idle_wakeup(void) {
+    matrix_idle_woken = true;
+#    ifdef PROTOCOL_CHIBIOS
+    chSysLockFromISR();
+    chThdResumeI(&matrix_idle_sleeper, MSG_OK);
+    chSysUnlockFromISR();
+#    endif
+}
+
+/**
+ * @brief Suspends the main thread, so the idle thread waits for an interrupt.
+ *
+ * Platforms without a way to be woken from the matrix interrupt don't sleep.
+ */
+__attribute__((weak)) void matrix_idle_sleep(uint32_t ms) {
+#    ifdef PROTOCOL_CHIBIOS
+    chSysLock();
+    if (!matrix_idle_woken) {
+        chThdSuspendTimeoutS(&matrix_idle_sleeper, TIME_MS2I(ms));
+    }
+    chSysUnlock();
+#    endif
+}
+
+// Wakes up for the next deferred executor, and at least every MATRIX_IDLE_SLEEP_MAX for everything polled
+static uint32_t matrix_idle_sleep_time(void) {
+    uint32_t sleep_ms = MATRIX_IDLE_SLEEP_MAX;
+#    ifdef DEFERRED_EXEC_ENABLE
+    uint32_t trigger_time;
+    if (deferred_exec_next_trigger_time(&trigger_time)) {
+        int32_t due_in = (int32_t)TIMER_DIFF_32(trigger_time, timer_read32());
+        if (due_in <= 0) {
+            return 0;
+        }
+        if ((uint32_t)due_in < sleep_ms) {
+            sleep_ms = due_in;
+        }
+    }
+#    endif
+    return sleep_ms;
+}
+
+bool matrix_is_idle(void) {
+    return matrix_idle;
+}
+
+__attribute__((weak)) bool matrix_idle_ready_kb(void) {
+    return matrix_idle_ready_user();
+}
+
+__attribute__((weak)) bool matrix_idle_ready_user(void) {
+    return true;
+}
+
+/**
+ * @brief Pauses matrix scanning once no key has been held for MATRIX_IDLE_TIMEOUT,
+ * and resumes it when the matrix reports a key change. While paused, the main loop
+ * sleeps until the key change or the next deferred execution.
+ *
+ * @return true Scanning is paused
+ */
+static bool matrix_idle_task(void) {
+    if (matrix_idle) {
+        if (!matrix_idle_woken) {
+            uint32_t sleep_ms = matrix_idle_sleep_time();
+            if (sleep_ms) {
+                matrix_idle_sleep(sleep_ms);
+            }
+        }
+        if (!matrix_idle_woken) {
+            return true;
+        }
+        // The key is still down, so the scan that follows picks it up as usual
+        matrix_idle_disarm();
+        matrix_idle = false;
+        return false;
+    }
+
+    if (last_matrix_activity_elapsed() < MATRIX_IDLE_TIMEOUT) {
+        return false;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix_previous[row]) {
+            return false;
+        }
+    }
+    if (!matrix_idle_ready_kb()) {
+        return false;
+    }
+
+    matrix_idle_woken = false;
+    matrix_idle       = matrix_idle_arm();
+    return matrix_idle;
+}
+#endif // MATRIX_IDLE_TIMEOUT
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -594,14 +684,21 @@ static bool matrix_task(void) {
         return false;
     }
 
+#ifdef MATRIX_IDLE_TIMEOUT
+    if (matrix_idle_task()) {
+        // matrix_scan() normally calls these, and keyboards rely on them for periodic work
+        matrix_scan_kb();
+        generate_tick_event();
+        return false;
+    }
+#endif
+
     matrix_scan();
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
         matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
     }
 
-    matrix_scan_perf_task();
-
     // Short-circuit the complete matrix processing if it is not necessary
     if (!matrix_changed) {
         generate_tick_event();
@@ -626,9 +723,16 @@ static bool matrix_task(void) {
         for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
             if (row_changes & col_mask) {
                 const bool key_pressed = current_row & col_mask;
+#ifdef LATENCY_TRACE_ENABLE
+                const uint32_t raw_time = latency_trace_key_changed(row, col, key_pressed);
+#endif // LATENCY_TRACE_ENABLE
 
                 if (process_keypress && !keypress_is_wakeup_key(row, col)) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#ifdef LATENCY_TRACE_ENABLE
+                    event.raw_time = raw_time;
+#endif // LATENCY_TRACE_ENABLE
+                    action_exec(event);
                 }
 
                 switch_events(row, col, key_pressed);
@@ -709,12 +813,16 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
+    scan_stats_task();
+
     if (matrix_task()) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
+    scan_stats_mark(SCAN_STATS_TASK_MATRIX);
 
     quantum_task();
+    scan_stats_mark(SCAN_STATS_TASK_QUANTUM);
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -736,6 +844,7 @@ void keyboard_task(void) {
     backlight_task();
 #    endif
 #endif
+    scan_stats_mark(SCAN_STATS_TASK_LIGHTING);
 
 #ifdef ENCODER_ENABLE
     if (encoder_task()) {
@@ -750,6 +859,7 @@ void keyboard_task(void) {
         activity_has_occurred = true;
     }
 #endif
+    scan_stats_mark(SCAN_STATS_TASK_INPUT);
 
 #ifdef OLED_ENABLE
     oled_task();
@@ -766,6 +876,7 @@ void keyboard_task(void) {
     if (activity_has_occurred) st7565_on();
 #    endif
 #endif
+    scan_stats_mark(SCAN_STATS_TASK_DISPLAY);
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
@@ -801,4 +912,5 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+    scan_stats_mark(SCAN_STATS_TASK_OTHER);
 }
@@ -40,6 +40,9 @@ typedef struct {
     uint16_t        time;
     keyevent_type_t type;
     bool            pressed;
+#ifdef LATENCY_TRACE_ENABLE
+    uint32_t raw_time; // timer_read_us() of the raw matrix change before debouncing, 0 if unknown
+#endif
 } keyevent_t;
 
 /* equivalent test of keypos_t */
@@ -175,8 +175,61 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+// Keymaps that replace key_override_get() with a longer list can define KEY_OVERRIDE_INDEX_SIZE, longer lists are searched in full
+#    ifdef KEY_OVERRIDE_INDEX_SIZE
+STATIC_ASSERT(KEY_OVERRIDE_INDEX_SIZE <= 255, "KEY_OVERRIDE_INDEX_SIZE must not exceed 255");
+#    else
+#        define KEY_OVERRIDE_INDEX_SIZE (ARRAY_SIZE(key_overrides) < 255 ? ARRAY_SIZE(key_overrides) : 255)
+#    endif
+
+uint8_t       key_override_index_overrides[KEY_OVERRIDE_INDEX_SIZE];
+uint16_t      key_override_index_triggers[KEY_OVERRIDE_INDEX_SIZE];
+const uint8_t key_override_index_size = KEY_OVERRIDE_INDEX_SIZE;
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Key
+
+#if defined(LEADER_ENABLE)
+
+// LEADER_TRIE_ENABLE is defined by keymap.c when it was generated from a keymap.json with `leader_sequences`
+#    if defined(LEADER_TRIE_ENABLE)
+
+uint16_t leader_trie_count_raw(void) {
+    return ARRAY_SIZE(leader_trie);
+}
+
+bool leader_trie_get_raw(uint16_t node_idx, leader_trie_node_t* node) {
+    if (node_idx >= leader_trie_count_raw()) {
+        return false;
+    }
+    memcpy_P(node, &leader_trie[node_idx], sizeof(leader_trie_node_t));
+    return true;
+}
+
+#    else
+
+uint16_t leader_trie_count_raw(void) {
+    return 0;
+}
+
+bool leader_trie_get_raw(uint16_t node_idx, leader_trie_node_t* node) {
+    return false;
+}
+
+#    endif // defined(LEADER_TRIE_ENABLE)
+
+__attribute__((weak)) uint16_t leader_trie_count(void) {
+    return leader_trie_count_raw();
+}
+
+__attribute__((weak)) bool leader_trie_get(uint16_t node_idx, leader_trie_node_t* node) {
+    return leader_trie_get_raw(node_idx, node);
+}
+
+#endif // defined(LEADER_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Community modules (must be last in this file!)
 
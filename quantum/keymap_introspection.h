@@ -108,4 +108,30 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+// Storage for the key override trigger index, sized for the overrides in the keymap unless KEY_OVERRIDE_INDEX_SIZE is defined
+extern uint8_t       key_override_index_overrides[];
+extern uint16_t      key_override_index_triggers[];
+extern const uint8_t key_override_index_size;
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Key
+
+#if defined(LEADER_ENABLE)
+
+// Forward declaration of leader_trie_node_t so we don't need to deal with header reordering
+struct leader_trie_node_t;
+typedef struct leader_trie_node_t leader_trie_node_t;
+
+// Get the number of leader trie nodes generated from the user's keymap.json, stored in firmware rather than any other persistent storage
+uint16_t leader_trie_count_raw(void);
+// Get the number of leader trie nodes, potentially stored dynamically
+uint16_t leader_trie_count(void);
+
+// Read a leader trie node, stored in firmware rather than any other persistent storage. Returns false if out of range
+bool leader_trie_get_raw(uint16_t node_idx, leader_trie_node_t* node);
+// Read a leader trie node, potentially stored dynamically. Returns false if out of range
+bool leader_trie_get(uint16_t node_idx, leader_trie_node_t* node);
+
+#endif // defined(LEADER_ENABLE)
@@ -0,0 +1,173 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <inttypes.h>
+#include <string.h>
+#include "latency_trace.h"
+#include "quantum.h"
+#include "timer.h"
+#include "print.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+#ifdef SPLIT_KEYBOARD
+extern uint8_t thisHand;
+#else
+#    define thisHand 0
+#endif
+
+static latency_histogram_t histograms[LATENCY_PATH_COUNT];
+
+// The key event currently in process_record()
+static latency_sample_t current;
+// The last key event that didn't send a report itself, e.g. a tap dance waiting for its timeout. A report sent
+// outside of process_record() before the next key event is attributed to it.
+static latency_sample_t pending;
+
+// The raw matrix as last seen, and the keys' state as last seen in the debounced matrix
+static matrix_row_t raw_rows[MATRIX_ROWS];
+static matrix_row_t debounced_rows[MATRIX_ROWS];
+// Time of the first raw change of each key since its last debounced change, 0 if there is none
+static uint32_t raw_change_times[MATRIX_ROWS][MATRIX_COLS];
+
+void latency_trace_matrix_changed(const matrix_row_t raw[]) {
+    uint32_t now = timer_read_us();
+    if (!now) {
+        now--; // 0 means not stamped, a microsecond early doesn't matter
+    }
+
+    for (uint8_t i = 0; i < MATRIX_ROWS_PER_HAND; i++) {
+        uint8_t      row     = thisHand + i;
+        matrix_row_t changes = raw[i] ^ raw_rows[row];
+        raw_rows[row]        = raw[i];
+
+        for (uint8_t col = 0; changes; col++, changes >>= 1) {
+            if (!(changes & 1) || !((raw[i] ^ debounced_rows[row]) & ((matrix_row_t)1 << col))) {
+                continue;
+            }
+            // Keep the first edge while the key is still bouncing. One from longer ago was a glitch that debouncing
+            // filtered out.
+            uint32_t *time = &raw_change_times[row][col];
+            if (!*time || timer_elapsed_us(*time) > DEBOUNCE * 1000UL) {
+                *time = now;
+            }
+        }
+    }
+}
+
+uint32_t latency_trace_key_changed(uint8_t row, uint8_t col, bool pressed) {
+    matrix_row_t mask          = (matrix_row_t)1 << col;
+    uint32_t     time          = raw_change_times[row][col];
+    raw_change_times[row][col] = 0;
+    debounced_rows[row]        = pressed ? debounced_rows[row] | mask : debounced_rows[row] & ~mask;
+    return time;
+}
+
+static latency_path_t latency_trace_path(keyrecord_t *record) {
+    if (IS_COMBOEVENT(record->event)) {
+        return LATENCY_PATH_COMBO;
+    }
+
+    uint16_t keycode = get_record_keycode(record, false);
+    if (IS_QK_TAP_DANCE(keycode)) {
+        return LATENCY_PATH_TAP_DANCE;
+    }
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        return LATENCY_PATH_MOD_TAP;
+    }
+    return LATENCY_PATH_PLAIN;
+}
+
+static void latency_trace_record(latency_sample_t *sample) {
+    latency_histogram_t *histogram = &histograms[sample->path];
+    uint32_t             latency   = timer_elapsed_us(sample->time);
+
+    uint8_t bucket = 0;
+    for (uint32_t us = latency; us && bucket < LATENCY_TRACE_BUCKETS - 1; us >>= 1) {
+        bucket++;
+    }
+
+    if (histogram->count == UINT16_MAX) {
+        return;
+    }
+    if (!histogram->count || latency < histogram->min) {
+        histogram->min = latency;
+    }
+    if (latency > histogram->max) {
+        histogram->max = latency;
+    }
+    histogram->count++;
+    histogram->total += latency;
+    histogram->buckets[bucket]++;
+
+    sample->active = false;
+}
+
+// Whether both samples are events of the same tap dance key
+static bool latency_trace_same_dance(const latency_sample_t *a, const latency_sample_t *b) {
+    return a->path == LATENCY_PATH_TAP_DANCE && b->path == LATENCY_PATH_TAP_DANCE && KEYEQ(a->key, b->key);
+}
+
+latency_sample_t latency_trace_begin(keyrecord_t *record) {
+    latency_sample_t outer = current;
+
+    // Events that weren't stamped in the raw matrix, such as the other half's keys, are timed from the debounced
+    // change at millisecond resolution
+    uint32_t time = record->event.raw_time;
+    if (!time) {
+        time = timer_read_us() - (uint32_t)TIMER_DIFF_16(timer_read(), record->event.time) * 1000;
+    }
+    current = (latency_sample_t){.time = time, .key = record->event.key, .path = latency_trace_path(record), .active = true};
+
+    // A tap dance is measured from its first event, so only events of another key give up on its report
+    if (!latency_trace_same_dance(&pending, &current)) {
+        pending.active = false;
+    }
+    return outer;
+}
+
+void latency_trace_end(latency_sample_t outer) {
+    if (current.active && !outer.active && !pending.active) {
+        pending = current;
+    }
+    current = outer;
+}
+
+void latency_trace_report_sent(void) {
+    // Any sample still pending while an event is in progress belongs to the same tap dance, and is the earlier one
+    if (pending.active) {
+        latency_trace_record(&pending);
+        current.active = false;
+    } else if (current.active) {
+        latency_trace_record(&current);
+    }
+}
+
+const latency_histogram_t *latency_trace_get(latency_path_t path) {
+    return &histograms[path];
+}
+
+void latency_trace_clear(void) {
+    memset(histograms, 0, sizeof(histograms));
+    pending.active = false;
+}
+
+void latency_trace_print(void) {
+#ifdef CONSOLE_ENABLE
+    static const char *const names[LATENCY_PATH_COUNT] = {"plain", "mod-tap", "combo", "tap dance"};
+
+    for (uint8_t path = 0; path < LATENCY_PATH_COUNT; path++) {
+        const latency_histogram_t *histogram = &histograms[path];
+        if (!histogram->count) {
+            continue;
+        }
+        uprintf("latency %s: n=%u min=%" PRIu32 " avg=%" PRIu32 " max=%" PRIu32 " |", names[path], histogram->count, histogram->min, (uint32_t)(histogram->total / histogram->count), histogram->max);
+        for (uint8_t i = 0; i < LATENCY_TRACE_BUCKETS; i++) {
+            uprintf(" %u", histogram->buckets[i]);
+        }
+        uprint("\n");
+    }
+#endif
+}
@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "action.h"
+#include "matrix.h"
+
+/**
+ * Number of histogram buckets. Bucket 0 counts 0us, bucket n counts [2^(n-1), 2^n) us and the last bucket counts
+ * everything above.
+ */
+#ifndef LATENCY_TRACE_BUCKETS
+#    define LATENCY_TRACE_BUCKETS 20
+#endif
+
+/** \brief The feature path a key event took before its report was sent. */
+typedef enum {
+    LATENCY_PATH_PLAIN,
+    LATENCY_PATH_MOD_TAP,
+    LATENCY_PATH_COMBO,
+    LATENCY_PATH_TAP_DANCE,
+    LATENCY_PATH_COUNT,
+} latency_path_t;
+
+/** \brief Latencies of one path, in microseconds. */
+typedef struct {
+    uint16_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint16_t buckets[LATENCY_TRACE_BUCKETS];
+} latency_histogram_t;
+
+/** \brief An in-flight key event, waiting for the report it results in. */
+typedef struct {
+    uint32_t time; // timer_read_us() of the raw matrix change
+    keypos_t key;
+    uint8_t  path;
+    bool     active;
+} latency_sample_t;
+
+/**
+ * \brief Stamps the keys that changed in the raw matrix, before debouncing.
+ *
+ * Called by `matrix_scan()` with this half's rows when the raw matrix has changed.
+ */
+void latency_trace_matrix_changed(const matrix_row_t raw[]);
+
+/**
+ * \brief Returns the time of the raw change behind a debounced key change, or 0 if it wasn't stamped.
+ *
+ * Called for every debounced change of the matrix, so the next raw change of the key is stamped afresh.
+ */
+uint32_t latency_trace_key_changed(uint8_t row, uint8_t col, bool pressed);
+
+/**
+ * \brief Starts tracing a key event.
+ *
+ * Called by `process_record()`, which can nest, so the outer event's sample is returned to be handed back to
+ * `latency_trace_end()`.
+ */
+latency_sample_t latency_trace_begin(keyrecord_t *record);
+
+/** \brief Stops tracing the current key event and resumes the outer one. */
+void latency_trace_end(latency_sample_t outer);
+
+/** \brief Records the latency of the traced key event, if any. Called when a keyboard report is sent. */
+void latency_trace_report_sent(void);
+
+/** \brief Returns the histogram for the given path. */
+const latency_histogram_t *latency_trace_get(latency_path_t path);
+
+/** \brief Clears all histograms and drops the key event waiting for a report, if any. */
+void latency_trace_clear(void);
+
+/** \brief Prints all histograms to the console. */
+void latency_trace_print(void);
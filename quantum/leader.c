@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "leader.h"
+#include "keymap_introspection.h"
+#include "quantum.h"
 #include "timer.h"
 #include "util.h"
 
@@ -17,6 +19,11 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#define LEADER_TRIE_NO_NODE 0xFFFF
+
+// Trie node matching the sequence typed so far, LEADER_TRIE_NO_NODE once no compiled sequence can match
+static uint16_t leader_trie_node = LEADER_TRIE_NO_NODE;
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -25,6 +32,43 @@ __attribute__((weak)) bool leader_add_user(uint16_t keycode) {
     return false;
 }
 
+__attribute__((weak)) bool leader_trie_action_user(uint16_t keycode) {
+    return true;
+}
+
+/**
+ * \brief Moves down the trie along `keycode`.
+ *
+ * \return `true` if a sequence ends here and no longer sequence starts with it, so it can fire without waiting for the timeout.
+ */
+static bool leader_trie_advance(uint16_t keycode) {
+    leader_trie_node_t node;
+    if (leader_trie_node == LEADER_TRIE_NO_NODE || !leader_trie_get(leader_trie_node, &node)) {
+        return false;
+    }
+
+    leader_trie_node_t child;
+    for (uint16_t i = node.children; i < node.children + node.child_count; i++) {
+        if (leader_trie_get(i, &child) && child.keycode == keycode) {
+            leader_trie_node = i;
+            return child.action != KC_NO && child.child_count == 0;
+        }
+    }
+
+    leader_trie_node = LEADER_TRIE_NO_NODE;
+    return false;
+}
+
+static void leader_trie_finish(void) {
+    leader_trie_node_t node;
+    if (leader_trie_node != LEADER_TRIE_NO_NODE && leader_trie_get(leader_trie_node, &node) && node.action != KC_NO) {
+        if (leader_trie_action_user(node.action)) {
+            tap_code16(node.action);
+        }
+    }
+    leader_trie_node = LEADER_TRIE_NO_NODE;
+}
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -34,10 +78,12 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+    leader_trie_node = leader_trie_count() > 0 ? 0 : LEADER_TRIE_NO_NODE;
 }
 
 void leader_end(void) {
     leading = false;
+    leader_trie_finish();
     leader_end_user();
 }
 
@@ -65,7 +111,8 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
-    if (leader_add_user(keycode)) {
+    bool complete = leader_trie_advance(keycode);
+    if (leader_add_user(keycode) || complete) {
         leader_end();
     }
     return true;
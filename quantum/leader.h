@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -21,6 +23,32 @@ void leader_start_user(void);
  */
 void leader_end_user(void);
 
+/**
+ * \brief A node of the compiled leader sequence trie.
+ *
+ * The trie is generated from `leader_sequences` in `keymap.json`. Node 0 is the root,
+ * and the children of each node are stored next to each other.
+ */
+typedef struct leader_trie_node_t {
+    /** The keycode that leads from the parent to this node. */
+    uint16_t keycode;
+    /** The keycode to tap when the sequence ends on this node, `KC_NO` if no sequence ends here. */
+    uint16_t action;
+    /** The index of the first child node. */
+    uint16_t children;
+    /** The number of child nodes. */
+    uint8_t child_count;
+} leader_trie_node_t;
+
+/**
+ * \brief User callback, invoked when the leader sequence matches a sequence from the trie.
+ *
+ * \param keycode The action keycode of the matched sequence.
+ *
+ * \return `true` to tap the keycode, `false` if it has been handled.
+ */
+bool leader_trie_action_user(uint16_t keycode);
+
 /**
  * \brief User callback, invoked when a keycode is added to the leader sequence.
  *
@@ -21,6 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -58,6 +61,72 @@ static SPLIT_MUTABLE_COL pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
 #    endif // MATRIX_COL_PINS
 #endif
 
+#ifdef MATRIX_PORT_SCAN
+#    ifdef DIRECT_PINS
+#        error "MATRIX_PORT_SCAN is not supported with DIRECT_PINS"
+#    endif
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_INPUT_PORTS MATRIX_COL_PORTS
+#        define MATRIX_INPUT_PORT_RUNS MATRIX_COL_PORT_RUNS
+#        ifdef MATRIX_COL_PINS_RIGHT
+#            define MATRIX_INPUT_PORTS_RIGHT MATRIX_COL_PORTS_RIGHT
+#            define MATRIX_INPUT_PORT_RUNS_RIGHT MATRIX_COL_PORT_RUNS_RIGHT
+#        endif
+#    else
+#        define MATRIX_INPUT_PORTS MATRIX_ROW_PORTS
+#        define MATRIX_INPUT_PORT_RUNS MATRIX_ROW_PORT_RUNS
+#        ifdef MATRIX_ROW_PINS_RIGHT
+#            define MATRIX_INPUT_PORTS_RIGHT MATRIX_ROW_PORTS_RIGHT
+#            define MATRIX_INPUT_PORT_RUNS_RIGHT MATRIX_ROW_PORT_RUNS_RIGHT
+#        endif
+#    endif
+#    if !defined(MATRIX_COL_PORTS) && !defined(MATRIX_ROW_PORTS)
+#        error "MATRIX_PORT_SCAN requires the port tables generated from matrix_pins in info.json"
+#    endif
+
+// Consecutive port bits that map onto consecutive matrix inputs
+typedef struct {
+    uint8_t  port;  // index into the port list
+    uint8_t  shift; // first port bit
+    uint32_t mask;  // run mask, after shifting
+    uint8_t  index; // first matrix input
+} matrix_port_run_t;
+
+static const pin_t             input_ports[]     = MATRIX_INPUT_PORTS;
+static const matrix_port_run_t input_port_runs[] = MATRIX_INPUT_PORT_RUNS;
+#    ifdef MATRIX_INPUT_PORTS_RIGHT
+static const pin_t             input_ports_right[]     = MATRIX_INPUT_PORTS_RIGHT;
+static const matrix_port_run_t input_port_runs_right[] = MATRIX_INPUT_PORT_RUNS_RIGHT;
+#        define MATRIX_PORT_DATA_SIZE (ARRAY_SIZE(input_ports) > ARRAY_SIZE(input_ports_right) ? ARRAY_SIZE(input_ports) : ARRAY_SIZE(input_ports_right))
+#    else
+#        define MATRIX_PORT_DATA_SIZE ARRAY_SIZE(input_ports)
+#    endif
+
+static const pin_t             *matrix_ports          = input_ports;
+static uint8_t                  matrix_port_count     = ARRAY_SIZE(input_ports);
+static const matrix_port_run_t *matrix_port_runs      = input_port_runs;
+static uint8_t                  matrix_port_run_count = ARRAY_SIZE(input_port_runs);
+
+// Reads every input port once and gathers the pressed inputs into a bitmask
+static uint32_t matrix_read_input_ports(void) {
+    gpio_port_data_t port_data[MATRIX_PORT_DATA_SIZE];
+
+    for (uint8_t i = 0; i < matrix_port_count; i++) {
+        port_data[i] = gpio_read_port(matrix_ports[i]);
+#    if MATRIX_INPUT_PRESSED_STATE == 0
+        port_data[i] = ~port_data[i];
+#    endif
+    }
+
+    uint32_t pressed = 0;
+    for (uint8_t i = 0; i < matrix_port_run_count; i++) {
+        const matrix_port_run_t *run = &matrix_port_runs[i];
+        pressed |= ((uint32_t)(port_data[run->port] >> run->shift) & run->mask) << run->index;
+    }
+    return pressed;
+}
+#endif // MATRIX_PORT_SCAN
+
 /* matrix state(1:on, 0:off) */
 extern matrix_row_t raw_matrix[MATRIX_ROWS]; // raw values
 extern matrix_row_t matrix[MATRIX_ROWS];     // debounced values
@@ -177,6 +246,9 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_SCAN
+    current_row_value = (matrix_row_t)matrix_read_input_ports();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -185,6 +257,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -240,10 +313,18 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_SCAN
+    uint32_t rows_pressed = matrix_read_input_ports();
+#            endif
+
     // For each row...
     for (uint8_t row_index = 0; row_index < MATRIX_ROWS_PER_HAND; row_index++) {
         // Check row pin state
+#            ifdef MATRIX_PORT_SCAN
+        if (rows_pressed & ((uint32_t)1 << row_index)) {
+#            else
         if (readMatrixPin(row_pins[row_index]) == 0) {
+#            endif
             // Pin LO, set col bit
             current_matrix[row_index] |= row_shifter;
             key_pressed = true;
@@ -266,6 +347,97 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#if defined(MATRIX_IDLE_TIMEOUT) && defined(gpio_enable_pin_interrupt) && (defined(DIRECT_PINS) || (defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)))
+#    if defined(DIRECT_PINS)
+#        define MATRIX_IDLE_INPUT_COUNT (MATRIX_ROWS_PER_HAND * MATRIX_COLS)
+#        define MATRIX_IDLE_INPUT(i) (direct_pins[(i) / MATRIX_COLS][(i) % MATRIX_COLS])
+#    elif (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_IDLE_INPUT_COUNT MATRIX_COLS
+#        define MATRIX_IDLE_INPUT(i) (col_pins[i])
+#        define MATRIX_IDLE_OUTPUT_COUNT MATRIX_ROWS_PER_HAND
+#        define matrix_idle_select(i) select_row(i)
+#        define matrix_idle_unselect(i) unselect_row(i)
+#    else
+#        define MATRIX_IDLE_INPUT_COUNT MATRIX_ROWS_PER_HAND
+#        define MATRIX_IDLE_INPUT(i) (row_pins[i])
+#        define MATRIX_IDLE_OUTPUT_COUNT MATRIX_COLS
+#        define matrix_idle_select(i) select_col(i)
+#        define matrix_idle_unselect(i) unselect_col(i)
+#    endif
+
+static void matrix_idle_interrupt(void *arg) {
+    (void)arg;
+    matrix_idle_wakeup();
+}
+
+#    ifdef gpio_pin_interrupt_line
+// Enabling the interrupt of an input whose line is taken by another input would leave one of them unable to wake the matrix
+static bool matrix_idle_lines_shared(void) {
+    for (uint8_t i = 0; i < MATRIX_IDLE_INPUT_COUNT; i++) {
+        if (MATRIX_IDLE_INPUT(i) == NO_PIN) continue;
+        for (uint8_t j = i + 1; j < MATRIX_IDLE_INPUT_COUNT; j++) {
+            if (MATRIX_IDLE_INPUT(j) != NO_PIN && gpio_pin_interrupt_line(MATRIX_IDLE_INPUT(i)) == gpio_pin_interrupt_line(MATRIX_IDLE_INPUT(j))) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+#    endif
+
+bool matrix_idle_arm(void) {
+#    ifdef gpio_pin_interrupt_line
+    static bool lines_checked = false;
+    static bool lines_shared  = false;
+    if (!lines_checked) {
+        lines_shared  = matrix_idle_lines_shared();
+        lines_checked = true;
+    }
+    if (lines_shared) {
+        return false;
+    }
+#    endif
+
+#    ifdef MATRIX_IDLE_OUTPUT_COUNT
+    // Select every line at once, so any key press pulls its input
+    for (uint8_t i = 0; i < MATRIX_IDLE_OUTPUT_COUNT; i++) {
+        matrix_idle_select(i);
+    }
+    matrix_output_select_delay();
+#    endif
+
+    for (uint8_t i = 0; i < MATRIX_IDLE_INPUT_COUNT; i++) {
+        if (MATRIX_IDLE_INPUT(i) != NO_PIN) {
+            gpio_enable_pin_interrupt(MATRIX_IDLE_INPUT(i), matrix_idle_interrupt);
+        }
+    }
+
+    // A key pressed before the interrupts were enabled raises no edge, so catch it here
+    for (uint8_t i = 0; i < MATRIX_IDLE_INPUT_COUNT; i++) {
+        if (readMatrixPin(MATRIX_IDLE_INPUT(i)) == 0) {
+            matrix_idle_disarm();
+            return false;
+        }
+    }
+    return true;
+}
+
+void matrix_idle_disarm(void) {
+    for (uint8_t i = 0; i < MATRIX_IDLE_INPUT_COUNT; i++) {
+        if (MATRIX_IDLE_INPUT(i) != NO_PIN) {
+            gpio_disable_pin_interrupt(MATRIX_IDLE_INPUT(i));
+        }
+    }
+
+#    ifdef MATRIX_IDLE_OUTPUT_COUNT
+    for (uint8_t i = 0; i < MATRIX_IDLE_OUTPUT_COUNT; i++) {
+        matrix_idle_unselect(i);
+    }
+    matrix_output_unselect_delay(0, true);
+#    endif
+}
+#endif // MATRIX_IDLE_TIMEOUT
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -289,6 +461,12 @@ void matrix_init(void) {
         for (uint8_t i = 0; i < MATRIX_COLS; i++) {
             col_pins[i] = col_pins_right[i];
         }
+#    endif
+#    ifdef MATRIX_INPUT_PORTS_RIGHT
+        matrix_ports          = input_ports_right;
+        matrix_port_count     = ARRAY_SIZE(input_ports_right);
+        matrix_port_runs      = input_port_runs_right;
+        matrix_port_run_count = ARRAY_SIZE(input_port_runs_right);
 #    endif
     }
 
@@ -334,6 +512,10 @@ uint8_t matrix_scan(void) {
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+#ifdef LATENCY_TRACE_ENABLE
+    // Stamped before debouncing, so that the debounce delay counts towards the latency
+    if (changed) latency_trace_matrix_changed(raw_matrix);
+#endif
 
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, changed) | matrix_post_scan();
@@ -87,6 +87,27 @@ void matrix_slave_scan_kb(void);
 void matrix_slave_scan_user(void);
 #endif
 
+#ifdef MATRIX_IDLE_TIMEOUT
+/* longest the main loop sleeps at a time while idle, in milliseconds, 0 to never sleep */
+#    ifndef MATRIX_IDLE_SLEEP_MAX
+#        define MATRIX_IDLE_SLEEP_MAX 10
+#    endif
+
+/* idle mode: select every line and wait for an input interrupt instead of scanning.
+ * Returns false if the matrix cannot be armed, or a key is already held. */
+bool matrix_idle_arm(void);
+void matrix_idle_disarm(void);
+/* called by the matrix, from interrupt context, when a key changes state while armed */
+void matrix_idle_wakeup(void);
+/* whether scanning is currently paused */
+bool matrix_is_idle(void);
+/* sleeps for up to `ms` milliseconds, returning early on matrix_idle_wakeup() */
+void matrix_idle_sleep(uint32_t ms);
+
+bool matrix_idle_ready_kb(void);
+bool matrix_idle_ready_user(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
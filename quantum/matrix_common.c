@@ -3,6 +3,9 @@
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -129,6 +132,14 @@ __attribute__((weak)) void matrix_output_unselect_delay(uint8_t line, bool key_p
     matrix_io_delay();
 }
 
+#ifdef MATRIX_IDLE_TIMEOUT
+// Custom matrices stay in scanning mode unless they implement idle mode themselves
+__attribute__((weak)) bool matrix_idle_arm(void) {
+    return false;
+}
+__attribute__((weak)) void matrix_idle_disarm(void) {}
+#endif
+
 // CUSTOM MATRIX 'LITE'
 __attribute__((weak)) void matrix_init_custom(void) {}
 __attribute__((weak)) bool matrix_scan_custom(matrix_row_t current_matrix[]) {
@@ -163,6 +174,10 @@ __attribute__((weak)) void matrix_init(void) {
 
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
+#ifdef LATENCY_TRACE_ENABLE
+    // Stamped before debouncing, so that the debounce delay counts towards the latency
+    if (changed) latency_trace_matrix_changed(raw_matrix);
+#endif
 
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, changed) | matrix_post_scan();
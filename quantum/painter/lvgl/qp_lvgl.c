@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_lvgl.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
 #include "timer.h"
 #include "deferred_exec.h"
 #include "lvgl.h"
@@ -19,17 +21,60 @@ static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_ta
 painter_device_t selected_display = NULL;
 void            *color_buffer     = NULL;
 
+static lv_disp_drv_t *flushing_disp = NULL; // Set until the area being sent to the display is handed back to LVGL
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
+// Hands the area's buffer back to LVGL once it has been sent. Unless wait is set, returns straight away if the transfer
+// is still in progress.
+static void qp_lvgl_flush_complete(bool wait) {
+    if (!flushing_disp) {
+        return;
+    }
+    while (qp_comms_busy(selected_display)) {
+        if (!wait) {
+            return;
+        }
+    }
+
+    qp_flush(selected_display);
+    lv_disp_drv_t *disp = flushing_disp;
+    flushing_disp       = NULL;
+    lv_disp_flush_ready(disp);
+}
+
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
-    if (selected_display) {
-        uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
-        qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
-        qp_pixdata(selected_display, (void *)color_p, number_pixels);
-        qp_flush(selected_display);
+    painter_driver_t *driver = (painter_driver_t *)selected_display;
+    if (!driver) {
+        return;
+    }
+
+    // Stream the area to the panel, while LVGL carries on rendering into the other buffer
+    uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+    if (!qp_comms_start(selected_display)) {
+        qp_dprintf("qp_lvgl_flush: fail (could not start comms)\n");
         lv_disp_flush_ready(disp);
+        return;
     }
+    if (!driver->driver_vtable->viewport(selected_display, area->x1, area->y1, area->x2, area->y2) || !qp_internal_pixdata_async(selected_display, color_p, number_pixels)) {
+        qp_dprintf("qp_lvgl_flush: fail (could not send area)\n");
+        qp_comms_stop(selected_display);
+        lv_disp_flush_ready(disp);
+        return;
+    }
+
+    // The bus is released as soon as the transfer completes, so other devices on it aren't held up until the next poll
+    qp_comms_stop_async(selected_display);
+    flushing_disp = disp;
+
+    // Displays without asynchronous transfers are already done
+    qp_lvgl_flush_complete(false);
+}
+
+// Called by LVGL while it waits for the other buffer to become free again
+static void qp_lvgl_flush_wait(lv_disp_drv_t *disp) {
+    qp_lvgl_flush_complete(false);
 }
 
 static uint32_t tick_task_callback(uint32_t trigger_time, void *cb_arg) {
@@ -95,18 +140,18 @@ bool qp_lvgl_attach(painter_device_t device) {
 
     // Set up lvgl display buffer
     static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
-    const size_t count_required   = driver->panel_width * driver->panel_height / 10;
-    void        *new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required);
+    // Allocate two partial screen buffers, so that one can be rendered into while the other one is being sent
+    const size_t count_required   = driver->panel_width * driver->panel_height / QP_LVGL_BUFFER_DIVISOR;
+    void        *new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required * 2);
     if (!new_color_buffer) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
         qp_lvgl_detach();
         return false;
     }
     color_buffer = new_color_buffer;
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
+    memset(color_buffer, 0, sizeof(lv_color_t) * count_required * 2);
     // Initialize the display buffer.
-    lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
+    lv_disp_draw_buf_init(&draw_buf, color_buffer, (lv_color_t *)color_buffer + count_required, count_required);
 
     selected_display = device;
 
@@ -114,13 +159,14 @@ bool qp_lvgl_attach(painter_device_t device) {
     qp_get_geometry(selected_display, &panel_width, &panel_height, NULL, &offset_x, &offset_y);
 
     // Setting up display driver
-    static lv_disp_drv_t disp_drv;     /*Descriptor of a display driver*/
-    lv_disp_drv_init(&disp_drv);       /*Basic initialization*/
-    disp_drv.flush_cb = qp_lvgl_flush; /*Set your driver function*/
-    disp_drv.draw_buf = &draw_buf;     /*Assign the buffer to the display*/
-    disp_drv.hor_res  = panel_width;   /*Set the horizontal resolution of the display*/
-    disp_drv.ver_res  = panel_height;  /*Set the vertical resolution of the display*/
-    lv_disp_drv_register(&disp_drv);   /*Finally register the driver*/
+    static lv_disp_drv_t disp_drv;          /*Descriptor of a display driver*/
+    lv_disp_drv_init(&disp_drv);            /*Basic initialization*/
+    disp_drv.flush_cb = qp_lvgl_flush;      /*Set your driver function*/
+    disp_drv.wait_cb  = qp_lvgl_flush_wait; /*Poll for the flush to complete*/
+    disp_drv.draw_buf = &draw_buf;          /*Assign the buffer to the display*/
+    disp_drv.hor_res  = panel_width;        /*Set the horizontal resolution of the display*/
+    disp_drv.ver_res  = panel_height;       /*Set the vertical resolution of the display*/
+    lv_disp_drv_register(&disp_drv);        /*Finally register the driver*/
 
     return true;
 }
@@ -132,6 +178,8 @@ void qp_lvgl_detach(void) {
     for (int i = 0; i < 2; ++i) {
         cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
     }
+    // The buffer can't be freed while it's still being sent
+    qp_lvgl_flush_complete(true);
     if (color_buffer) {
         free(color_buffer);
         color_buffer = NULL;
@@ -143,6 +191,9 @@ void qp_lvgl_detach(void) {
 // Quantum Painter LVGL Integration Internal: qp_lvgl_internal_tick
 
 void qp_lvgl_internal_tick(void) {
+    // Hand the last area's buffer back to LVGL as soon as it's sent
+    qp_lvgl_flush_complete(false);
+
     static uint32_t last_lvgl_exec = 0;
     deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
 }
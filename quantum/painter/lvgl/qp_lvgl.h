@@ -11,6 +11,11 @@
 #    define QP_LVGL_TASK_PERIOD 5
 #endif
 
+// Each of the two draw buffers holds 1/QP_LVGL_BUFFER_DIVISOR of the screen
+#ifndef QP_LVGL_BUFFER_DIVISOR
+#    define QP_LVGL_BUFFER_DIVISOR 20
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
@@ -56,6 +56,25 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of recently used glyphs each loaded font remembers the location and width of, so that
+ *      repeated non-ASCII glyphs skip the lookup in the font's unicode table. Each entry uses 8 bytes of RAM per font
+ *      slot. Set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE 8
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_PALETTE_CACHE_SIZE
+/**
+ * @def This controls the number of recently used foreground/background color combinations whose palettes are kept
+ *      converted to each display's native pixel format, so that drawing recolored images and text with a few
+ *      alternating colors doesn't have to regenerate the palette every time. Only palettes of up to 16 colors are
+ *      cached, each entry uses about 80 bytes of RAM. Set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_PALETTE_CACHE_SIZE 4
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -64,6 +83,16 @@
 #    define QUANTUM_PAINTER_CONCURRENT_ANIMATIONS 4
 #endif // QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 
+#ifndef QUANTUM_PAINTER_ANIMATION_SLICE_MS
+/**
+ * @def This controls how many milliseconds an animation may spend drawing each time it gets processed. Frames that
+ *      take longer than this are drawn over several passes of the main loop, so that large animations don't cause
+ *      periodic drops in the matrix scan rate. Frames that fall behind schedule are skipped if the following frame
+ *      redraws everything they changed. Set to 0 to always draw whole frames at once.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_SLICE_MS 2
+#endif // QUANTUM_PAINTER_ANIMATION_SLICE_MS
+
 #ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE
 /**
  * @def This controls the maximum size of the pixel data buffer used for single blocks of transmission. Larger buffers
@@ -72,6 +101,16 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_ASYNC_PIXDATA
+/**
+ * @def This controls whether pixel data is sent asynchronously, where the comms support it (SPI displays on ChibiOS).
+ *      The pixel data buffer is doubled, and while one half is transferred by DMA the next pixels are decoded into the
+ *      other half, overlapping decoding of images and fonts with the bus transfer. Requires an extra
+ *      \ref QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_ASYNC_PIXDATA FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -88,6 +127,15 @@
 #    define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+/**
+ * @def This controls whether images and fonts using LZ compression can be drawn. LZ compressed assets are usually
+ *      smaller than RLE compressed ones, especially animations and large fonts, but decoding them requires 256 bytes of
+ *      extra RAM for the decoder's window.
+ */
+#    define QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION FALSE
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter types
 
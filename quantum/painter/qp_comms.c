@@ -46,6 +46,52 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+uint32_t qp_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_send_async: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // Fall back to sending synchronously if the comms can't do anything else
+    if (!driver->comms_vtable->comms_send_async) {
+        return driver->comms_vtable->comms_send(device, data, byte_count);
+    }
+
+    return driver->comms_vtable->comms_send_async(device, data, byte_count);
+}
+
+bool qp_comms_busy(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_busy: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // Comms without asynchronous sends are never left busy
+    if (!driver->comms_vtable->comms_busy) {
+        return false;
+    }
+
+    return driver->comms_vtable->comms_busy(device);
+}
+
+void qp_comms_stop_async(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_stop_async: fail (validation_ok == false)\n");
+        return;
+    }
+
+    // Fall back to waiting for the transfer if the comms can't end the transaction later on
+    if (!driver->comms_vtable->comms_stop_async) {
+        driver->comms_vtable->comms_stop(device);
+        return;
+    }
+
+    driver->comms_vtable->comms_stop_async(device);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
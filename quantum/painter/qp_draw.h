@@ -9,8 +9,21 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter utility functions
 
-// Global variable used for native pixel data streaming.
-extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Global variable used for native pixel data streaming. With QUANTUM_PAINTER_ASYNC_PIXDATA it points at whichever half
+// of the double buffer is free, so it must be re-read after each qp_internal_send_pixdata().
+extern uint8_t *qp_internal_global_pixdata_buffer;
+
+// Sends native pixels from the global pixdata buffer to the device. With QUANTUM_PAINTER_ASYNC_PIXDATA the transfer
+// may still be running on return, and the global pixdata buffer moves to the other half so the next pixels can be
+// prepared in the meantime. Paths that send the same buffer contents repeatedly call the driver's pixdata directly.
+bool qp_internal_send_pixdata(painter_device_t device, uint32_t native_pixel_count);
+
+// Sends native pixels that are left untouched until the transfer completes, so the driver may return before it does.
+// Completion can be checked with qp_comms_busy(), qp_comms_stop() waits for it and qp_comms_stop_async() doesn't.
+bool qp_internal_pixdata_async(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count);
+
+// Checks whether the pixel data is safe to send asynchronously, i.e. it's being sent by qp_internal_pixdata_async().
+bool qp_internal_pixdata_can_send_async(const void* pixel_data);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -27,6 +40,12 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Draws the 4-way symmetric points (±x, ±y) around the center for every x in [x0, x1], as horizontal runs. If filled, each row is filled between its outermost points instead.
+bool qp_internal_symmetric_hrun_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t x0, uint16_t x1, uint16_t y, bool filled);
+
+// Draws the 4-way symmetric points (±x, ±y) around the center for every y in [y0, y1], as vertical runs. If filled, each row is filled between its outermost points instead.
+bool qp_internal_symmetric_vrun_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t x, uint16_t y0, uint16_t y1, bool filled);
+
 // Convert from input pixel data + palette to equivalent pixels
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
 typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
@@ -44,11 +63,11 @@ extern qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
 // Generates a color-interpolated lookup table based off the number of items, from foreground to background, for use with monochrome image rendering.
-// Returns true if a palette was created, false if the palette is reused.
-// As this uses a global, this may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() below to reset.
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
+// The lookup table is converted to the device's native pixel format. Palettes are reused if they're already in the lookup table or were converted recently.
+// Returns false if the palette could not be converted.
+bool qp_internal_interpolate_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated. Needed whenever the lookup table is overwritten with something else.
 void qp_internal_invalidate_palette(void);
 
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
@@ -63,6 +82,12 @@ enum qp_internal_rle_mode_t {
     NON_REPEATING_RUN,
 };
 
+enum qp_internal_lz_mode_t {
+    LZ_CONTROL_BYTE,
+    LZ_LITERAL_RUN,
+    LZ_MATCH,
+};
+
 typedef struct qp_internal_byte_input_state_t {
     painter_device_t device;
     qp_stream_t*     src_stream;
@@ -73,6 +98,13 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            enum qp_internal_lz_mode_t mode;
+            uint8_t                    remain;    // number of bytes remaining in the current mode
+            uint8_t                    distance;  // distance of the current match, minus one
+            uint8_t                    write_pos; // position of the next decoded byte in the window
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
@@ -97,4 +129,9 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 //     - qp_internal_send_bytes                                  (bpp > 8)
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
 
+// Same as qp_internal_appender, but for a block of row_count rows of row_pixels each. Once budget_ms milliseconds have
+// passed it stops at the next row boundary it can resume from, so that large images can be drawn over several calls.
+// A budget of zero sends every row. The number of rows sent is written to rows_sent, if supplied.
+bool qp_internal_appender_rows(painter_device_t device, uint8_t bpp, uint32_t row_pixels, uint16_t row_count, uint16_t budget_ms, uint16_t* rows_sent, qp_internal_byte_input_callback input_callback, void* input_state);
+
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
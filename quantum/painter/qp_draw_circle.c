@@ -8,118 +8,20 @@
 #include "qp_draw.h"
 
 // Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx0, uint16_t offsetx1, uint16_t offsety, bool filled) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
-    Two special cases exist and have been optimized:
-    1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    Consecutive points sharing the same offsety are drawn together: mirrored
+    above and below the center they form horizontal runs, and mirrored across
+    the diagonal they form vertical runs. For filled circles, the horizontal
+    runs are widened to span the circle, and the vertical runs become
+    rectangles, as every row they cover has the same width.
     */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t xpy = ((int16_t)centerx) + ((int16_t)offsety);
-    int16_t xmy = ((int16_t)centerx) - ((int16_t)offsety);
-    int16_t ypx = ((int16_t)centery) + ((int16_t)offsetx);
-    int16_t ymx = ((int16_t)centery) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
-
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
-            return false;
-        }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
-        }
-    } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
-        }
-
-    } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
-                return false;
-            }
-        }
-    }
-
-    return true;
+    return qp_internal_symmetric_hrun_impl(device, centerx, centery, offsetx0, offsetx1, offsety, filled) && qp_internal_symmetric_vrun_impl(device, centerx, centery, offsety, offsetx0, offsetx1, filled);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,34 +40,37 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     int16_t ycalc = (int16_t)radius;
     int16_t err   = ((5 - (radius >> 2)) >> 2);
 
-    qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    // Filled circles are drawn using rectangles, which need more than a single row of pixels
+    uint32_t diameter = (radius * 2) + 1;
+    qp_internal_fill_pixdata(device, filled ? diameter * diameter : diameter, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_circle: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
-        ret = false;
-    }
-
-    if (ret) {
-        while (xcalc < ycalc) {
-            xcalc++;
-            if (err < 0) {
-                err += (xcalc << 1) + 1;
-            } else {
-                ycalc--;
-                err += ((xcalc - ycalc) << 1) + 1;
-            }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+    bool    ret       = true;
+    int16_t run_start = xcalc;
+    while (xcalc < ycalc) {
+        xcalc++;
+        if (err < 0) {
+            err += (xcalc << 1) + 1;
+        } else {
+            // The next point moves to the next row, so draw the points so far
+            if (!qp_circle_helper_impl(device, x, y, run_start, xcalc - 1, ycalc, filled)) {
                 ret = false;
                 break;
             }
+            run_start = xcalc;
+            ycalc--;
+            err += ((xcalc - ycalc) << 1) + 1;
         }
     }
 
+    if (ret && !qp_circle_helper_impl(device, x, y, run_start, xcalc, ycalc, filled)) {
+        ret = false;
+    }
+
     qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
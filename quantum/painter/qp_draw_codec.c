@@ -55,12 +55,9 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 }
 
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    painter_driver_t* driver = (painter_driver_t*)device;
-    int16_t           steps  = 1 << bits_per_pixel; // number of items we need to interpolate
-    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps)) {
-        if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
-            return false;
-        }
+    int16_t steps = 1 << bits_per_pixel; // number of items we need to interpolate
+    if (!qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, steps)) {
+        return false;
     }
 
     return qp_internal_decode_palette(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_internal_global_pixel_lookup_table, output_callback, output_arg);
@@ -126,6 +123,53 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+// The last 256 decoded bytes, which matches are copied from. Only one asset is ever decoded at a time, so it's shared.
+static uint8_t qp_internal_lz_window[256];
+
+static inline int16_t qp_drawimage_byte_lz_decoder(void* cb_arg) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+
+    // Work out if we're parsing the control byte
+    if (state->lz.mode == LZ_CONTROL_BYTE) {
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return c;
+        }
+        if (c >= 128) {
+            int16_t distance = qp_stream_get(state->src_stream);
+            if (distance < 0) {
+                return distance;
+            }
+            state->lz.mode     = LZ_MATCH; // copy from earlier output
+            state->lz.remain   = c - 128 + 3;
+            state->lz.distance = distance;
+        } else {
+            state->lz.mode   = LZ_LITERAL_RUN; // copy from the stream
+            state->lz.remain = c + 1;
+        }
+    }
+
+    // Work out which byte we're returning, remembering it for later matches
+    if (state->lz.mode == LZ_LITERAL_RUN) {
+        state->curr = qp_stream_get(state->src_stream);
+        if (state->curr < 0) {
+            return state->curr;
+        }
+    } else {
+        state->curr = qp_internal_lz_window[(uint8_t)(state->lz.write_pos - state->lz.distance - 1)];
+    }
+    qp_internal_lz_window[state->lz.write_pos++] = state->curr;
+
+    // Swap back to querying the control byte once the run or match is complete
+    if (--state->lz.remain == 0) {
+        state->lz.mode = LZ_CONTROL_BYTE;
+    }
+
+    return state->curr;
+}
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -136,7 +180,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+        if (!qp_internal_send_pixdata(state->device, state->pixel_write_pos)) {
             return false;
         }
         state->pixel_write_pos = 0;
@@ -155,8 +199,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->byte_write_pos == state->max_bytes) {
-        painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+        if (!qp_internal_send_pixdata(state->device, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
         state->byte_write_pos = 0;
@@ -167,20 +210,38 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
 
 // Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
+    return qp_internal_appender_rows(device, bpp, pixel_count, 1, 0, NULL, input_callback, input_state);
+}
+
+bool qp_internal_appender_rows(painter_device_t device, uint8_t bpp, uint32_t row_pixels, uint16_t row_count, uint16_t budget_ms, uint16_t* rows_sent, qp_internal_byte_input_callback input_callback, void* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
 
-    bool ret = false;
+    bool     ret   = false;
+    uint16_t rows  = 0;
+    uint32_t start = timer_read32();
 
     // Non-native pixel format
     if (bpp <= 8) {
+        // Rows are packed back to back, so only stop where a row ends on a byte boundary
+        const uint8_t pixels_per_byte = 8 / bpp;
+        uint16_t      rows_per_step   = 1;
+        while ((row_pixels * rows_per_step) % pixels_per_byte != 0) {
+            rows_per_step <<= 1;
+        }
+
         // Set up the output state
         qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
-        // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+        // Decode the pixel data and stream to the display, until out of rows or time
+        do {
+            uint16_t step_rows = MIN(rows_per_step, row_count - rows);
+            ret                = qp_internal_decode_palette(device, row_pixels * step_rows, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+            rows += step_rows;
+        } while (ret && rows < row_count && (budget_ms == 0 || timer_elapsed32(start) < budget_ms));
+
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            ret &= qp_internal_send_pixdata(device, output_state.pixel_write_pos);
         }
     }
 
@@ -192,15 +253,22 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         // Set up the output state
         qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
 
-        // Stream the raw pixel data to the display
-        uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        // Stream the raw pixel data to the display, until out of rows or time
+        uint32_t row_bytes = row_pixels * bpp / 8;
+        do {
+            ret = qp_internal_send_bytes(device, row_bytes, input_callback, input_state, qp_internal_byte_appender, &output_state);
+            rows += 1;
+        } while (ret && rows < row_count && (budget_ms == 0 || timer_elapsed32(start) < budget_ms));
+
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            ret &= qp_internal_send_pixdata(device, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
         }
     }
 
+    if (rows_sent) {
+        *rows_sent = rows;
+    }
     return ret;
 }
 
@@ -212,6 +280,13 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.mode      = LZ_CONTROL_BYTE;
+            input_state->lz.remain    = 0;
+            input_state->lz.write_pos = 0;
+            return qp_drawimage_byte_lz_decoder;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
         default:
             return NULL;
     }
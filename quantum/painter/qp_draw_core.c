@@ -20,12 +20,22 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //       **** very likely get artifacts rendered to the screen as a result.                                       ****
 //
 
-// Buffer used for transmitting native pixel data to the downstream device.
-__attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Buffer used for transmitting native pixel data to the downstream device. With asynchronous pixdata there are two
+// halves, one is filled while the other one is still being sent.
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#else
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[1][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+uint8_t *qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[0];
+
+// Pixel data currently being handed over by qp_internal_pixdata_async()
+static const void *pixdata_async_buffer = NULL;
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
 static int16_t                                    generated_steps   = -1;
+static painter_device_t                           generated_device  = NULL;
 __attribute__((__aligned__(4))) static qp_pixel_t interpolated_fg_hsv888;
 __attribute__((__aligned__(4))) static qp_pixel_t interpolated_bg_hsv888;
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
@@ -34,6 +44,20 @@ __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table
 __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+// Generated palettes of up to 16 colors, already converted to the native pixel format of the device they were generated for
+typedef struct qp_internal_palette_cache_entry_t {
+    painter_device_t device;
+    qp_pixel_t       fg_hsv888;
+    qp_pixel_t       bg_hsv888;
+    int16_t          steps; // 0 if the entry is unused
+    qp_pixel_t       palette[16];
+} qp_internal_palette_cache_entry_t;
+
+__attribute__((__aligned__(4))) static qp_internal_palette_cache_entry_t palette_cache[QUANTUM_PAINTER_PALETTE_CACHE_SIZE];
+static uint8_t                                                           palette_cache_next = 0; // the oldest entry, replaced next
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
@@ -48,6 +72,34 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y)
     return driver->driver_vtable->viewport(device, x, y, x, y) && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, 1);
 }
 
+// Sends native pixels from the global pixdata buffer, then moves on to the other half if asynchronous pixdata is enabled
+bool qp_internal_send_pixdata(painter_device_t device, uint32_t native_pixel_count) {
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    bool ret = qp_internal_pixdata_async(device, qp_internal_global_pixdata_buffer, native_pixel_count);
+
+    // Only one transfer runs at a time, so the other half's transfer completed before this one started
+    qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[qp_internal_global_pixdata_buffer == qp_internal_pixdata_buffers[0] ? 1 : 0];
+    return ret;
+#else
+    painter_driver_t *driver = (painter_driver_t *)device;
+    return driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, native_pixel_count);
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+}
+
+// Sends pixel data which is left untouched until its transfer completes, letting the driver send it asynchronously
+bool qp_internal_pixdata_async(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    pixdata_async_buffer     = pixel_data;
+    bool ret                 = driver->driver_vtable->pixdata(device, pixel_data, native_pixel_count);
+    pixdata_async_buffer     = NULL;
+    return ret;
+}
+
+// Checks whether the pixel data is being sent by qp_internal_pixdata_async(), and stays untouched until its transfer completes
+bool qp_internal_pixdata_can_send_async(const void *pixel_data) {
+    return pixel_data != NULL && pixel_data == pixdata_async_buffer;
+}
+
 // Fills the global native pixel buffer with equivalent pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val) {
     painter_driver_t *driver            = (painter_driver_t *)device;
@@ -65,46 +117,97 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     }
 }
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated. Needed whenever the lookup table is overwritten with something else.
 void qp_internal_invalidate_palette(void) {
     generated_palette = false;
     generated_steps   = -1;
+    generated_device  = NULL;
+}
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+// Copies a cached palette into the lookup table, if there is one matching the parameters
+static bool qp_internal_palette_cache_lookup(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_SIZE; ++i) {
+        qp_internal_palette_cache_entry_t *entry = &palette_cache[i];
+        if (entry->steps == steps && entry->device == device && memcmp(&entry->fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&entry->bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
+            memcpy(qp_internal_global_pixel_lookup_table, entry->palette, steps * sizeof(qp_pixel_t));
+            return true;
+        }
+    }
+    return false;
 }
 
-// Interpolates between two colors to generate a palette
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+// Stores the converted palette in the lookup table, replacing the oldest entry
+static void qp_internal_palette_cache_insert(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    if (steps > 16) {
+        return;
+    }
+
+    qp_internal_palette_cache_entry_t *entry = &palette_cache[palette_cache_next];
+    entry->device                            = device;
+    entry->fg_hsv888                         = fg_hsv888;
+    entry->bg_hsv888                         = bg_hsv888;
+    entry->steps                             = steps;
+    memcpy(entry->palette, qp_internal_global_pixel_lookup_table, steps * sizeof(qp_pixel_t));
+    palette_cache_next = (palette_cache_next + 1) % QUANTUM_PAINTER_PALETTE_CACHE_SIZE;
+}
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+
+// Interpolates between two colors to generate a palette, and converts it to the device's native pixel format
+bool qp_internal_interpolate_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
     // Check if we need to generate a new palette -- if the input parameters match then assume the palette can stay unchanged.
-    // This may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() to reset.
-    if (generated_palette == true && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
+    if (generated_palette == true && generated_device == device && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
         // We already have the correct palette, no point regenerating it.
-        return false;
+        return true;
     }
 
-    // Save the parameters so we know whether we can skip generation
-    generated_palette      = true;
-    generated_steps        = steps;
-    interpolated_fg_hsv888 = fg_hsv888;
-    interpolated_bg_hsv888 = bg_hsv888;
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+    // Otherwise, the same palette may have been converted recently
+    bool cached = qp_internal_palette_cache_lookup(device, fg_hsv888, bg_hsv888, steps);
+#else
+    bool cached = false;
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+
+    if (!cached) {
+        int16_t hue_fg = fg_hsv888.hsv888.h;
+        int16_t hue_bg = bg_hsv888.hsv888.h;
+
+        // Make sure we take the "shortest" route from one hue to the other
+        if ((hue_fg - hue_bg) >= 128) {
+            hue_bg += 256;
+        } else if ((hue_fg - hue_bg) <= -128) {
+            hue_bg -= 256;
+        }
 
-    int16_t hue_fg = fg_hsv888.hsv888.h;
-    int16_t hue_bg = bg_hsv888.hsv888.h;
+        // Interpolate each of the lookup table entries
+        for (int16_t i = 0; i < steps; ++i) {
+            qp_internal_global_pixel_lookup_table[i].hsv888.h = (uint8_t)((hue_fg - hue_bg) * i / (steps - 1) + hue_bg);
+            qp_internal_global_pixel_lookup_table[i].hsv888.s = (uint8_t)((fg_hsv888.hsv888.s - bg_hsv888.hsv888.s) * i / (steps - 1) + bg_hsv888.hsv888.s);
+            qp_internal_global_pixel_lookup_table[i].hsv888.v = (uint8_t)((fg_hsv888.hsv888.v - bg_hsv888.hsv888.v) * i / (steps - 1) + bg_hsv888.hsv888.v);
 
-    // Make sure we take the "shortest" route from one hue to the other
-    if ((hue_fg - hue_bg) >= 128) {
-        hue_bg += 256;
-    } else if ((hue_fg - hue_bg) <= -128) {
-        hue_bg -= 256;
-    }
+            qp_dprintf("qp_internal_interpolate_palette: %3d of %d -- H: %3d, S: %3d, V: %3d\n", (int)(i + 1), (int)steps, (int)qp_internal_global_pixel_lookup_table[i].hsv888.h, (int)qp_internal_global_pixel_lookup_table[i].hsv888.s, (int)qp_internal_global_pixel_lookup_table[i].hsv888.v);
+        }
 
-    // Interpolate each of the lookup table entries
-    for (int16_t i = 0; i < steps; ++i) {
-        qp_internal_global_pixel_lookup_table[i].hsv888.h = (uint8_t)((hue_fg - hue_bg) * i / (steps - 1) + hue_bg);
-        qp_internal_global_pixel_lookup_table[i].hsv888.s = (uint8_t)((fg_hsv888.hsv888.s - bg_hsv888.hsv888.s) * i / (steps - 1) + bg_hsv888.hsv888.s);
-        qp_internal_global_pixel_lookup_table[i].hsv888.v = (uint8_t)((fg_hsv888.hsv888.v - bg_hsv888.hsv888.v) * i / (steps - 1) + bg_hsv888.hsv888.v);
+        // Convert the palette to native format
+        if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
+            qp_internal_invalidate_palette();
+            return false;
+        }
 
-        qp_dprintf("qp_internal_interpolate_palette: %3d of %d -- H: %3d, S: %3d, V: %3d\n", (int)(i + 1), (int)steps, (int)qp_internal_global_pixel_lookup_table[i].hsv888.h, (int)qp_internal_global_pixel_lookup_table[i].hsv888.s, (int)qp_internal_global_pixel_lookup_table[i].hsv888.v);
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+        qp_internal_palette_cache_insert(device, fg_hsv888, bg_hsv888, steps);
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
     }
 
+    // Save the parameters so we know whether we can skip generation
+    generated_palette      = true;
+    generated_device       = device;
+    generated_steps        = steps;
+    interpolated_fg_hsv888 = fg_hsv888;
+    interpolated_bg_hsv888 = bg_hsv888;
+
     return true;
 }
 
@@ -186,8 +289,6 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
-    qp_internal_fill_pixdata(device, 1, hue, sat, val);
-
     // draw angled line using Bresenham's algo
     int16_t x      = ((int16_t)x0);
     int16_t y      = ((int16_t)y0);
@@ -199,24 +300,42 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     int16_t e  = dx + dy;
     int16_t e2 = 2 * e;
 
+    // Consecutive pixels along the major axis are sent as a single run, so a mostly horizontal line costs one
+    // transaction per row rather than one per pixel
+    bool    x_major = dx >= -dy;
+    int16_t run_x   = x;
+    int16_t run_y   = y;
+    qp_internal_fill_pixdata(device, MAX(dx, -dy) + 1, hue, sat, val);
+
     bool ret = true;
     while (x != x1 || y != y1) {
-        if (!qp_internal_setpixel_impl(device, x, y)) {
-            ret = false;
-            break;
-        }
-        e2 = 2 * e;
+        int16_t next_x = x;
+        int16_t next_y = y;
+        e2             = 2 * e;
         if (e2 >= dy) {
             e += dy;
-            x += slopex;
+            next_x += slopex;
         }
         if (e2 <= dx) {
             e += dx;
-            y += slopey;
+            next_y += slopey;
+        }
+
+        // Draw the current run once the next pixel moves off its row or column
+        if (x_major ? (next_y != y) : (next_x != x)) {
+            if (!qp_internal_fillrect_helper_impl(device, run_x, run_y, x, y)) {
+                ret = false;
+                break;
+            }
+            run_x = next_x;
+            run_y = next_y;
         }
+
+        x = next_x;
+        y = next_y;
     }
-    // draw the last pixel
-    if (!qp_internal_setpixel_impl(device, x, y)) {
+    // draw the last run
+    if (ret && !qp_internal_fillrect_helper_impl(device, run_x, run_y, x, y)) {
         ret = false;
     }
 
@@ -225,6 +344,69 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Symmetric runs, shared by circles and ellipses
+
+// Runs of shapes crossing the panel edge may start at negative coordinates, which would wrap around as uint16_t.
+// Expects left <= right and top <= bottom, as the runs below are.
+static bool qp_internal_fillrect_clipped_impl(painter_device_t device, int16_t left, int16_t top, int16_t right, int16_t bottom) {
+    int16_t width  = (int16_t)qp_get_width(device);
+    int16_t height = (int16_t)qp_get_height(device);
+
+    // Entirely off the panel, nothing to draw
+    if (right < 0 || bottom < 0 || left >= width || top >= height) {
+        return true;
+    }
+
+    return qp_internal_fillrect_helper_impl(device, MAX(left, 0), MAX(top, 0), MIN(right, width - 1), MIN(bottom, height - 1));
+}
+
+bool qp_internal_symmetric_hrun_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t x0, uint16_t x1, uint16_t y, bool filled) {
+    int16_t cx     = ((int16_t)centerx);
+    int16_t top    = ((int16_t)centery) - ((int16_t)y);
+    int16_t bottom = ((int16_t)centery) + ((int16_t)y);
+
+    if (filled || x0 == 0) {
+        // Both halves meet in the middle, so each row is a single run
+        if (!qp_internal_fillrect_clipped_impl(device, cx - x1, bottom, cx + x1, bottom)) {
+            return false;
+        }
+        return y == 0 || qp_internal_fillrect_clipped_impl(device, cx - x1, top, cx + x1, top);
+    }
+
+    if (!qp_internal_fillrect_clipped_impl(device, cx + x0, bottom, cx + x1, bottom) || !qp_internal_fillrect_clipped_impl(device, cx - x1, bottom, cx - x0, bottom)) {
+        return false;
+    }
+    return y == 0 || (qp_internal_fillrect_clipped_impl(device, cx + x0, top, cx + x1, top) && qp_internal_fillrect_clipped_impl(device, cx - x1, top, cx - x0, top));
+}
+
+bool qp_internal_symmetric_vrun_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t x, uint16_t y0, uint16_t y1, bool filled) {
+    int16_t cy    = ((int16_t)centery);
+    int16_t left  = ((int16_t)centerx) - ((int16_t)x);
+    int16_t right = ((int16_t)centerx) + ((int16_t)x);
+
+    if (filled) {
+        // Every row of the run is filled to the same width, so each half is a single rectangle
+        if (y0 == 0) {
+            return qp_internal_fillrect_clipped_impl(device, left, cy - y1, right, cy + y1);
+        }
+        return qp_internal_fillrect_clipped_impl(device, left, cy + y0, right, cy + y1) && qp_internal_fillrect_clipped_impl(device, left, cy - y1, right, cy - y0);
+    }
+
+    for (uint8_t i = 0; i < (x == 0 ? 1 : 2); ++i) {
+        int16_t column = i == 0 ? right : left;
+        if (y0 == 0) {
+            // Both halves meet in the middle, so each column is a single run
+            if (!qp_internal_fillrect_clipped_impl(device, column, cy - y1, column, cy + y1)) {
+                return false;
+            }
+        } else if (!qp_internal_fillrect_clipped_impl(device, column, cy + y0, column, cy + y1) || !qp_internal_fillrect_clipped_impl(device, column, cy - y1, column, cy - y0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_rect
 
@@ -6,56 +6,6 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
-    /*
-    Ellipses have the property of 4-way symmetry, so four pixels can be drawn
-    for each computed [offsetx,offsety] given the center coordinates
-    represented by [centerx,centery].
-
-    For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
-    */
-
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
-
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
-    } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_ellipse
 
@@ -75,40 +25,66 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, MAX(sizex, sizey), hue, sat, val);
+    // Filled ellipses are partly drawn using rectangles, which need more than a single row of pixels
+    uint32_t width  = (sizex * 2) + 1;
+    uint32_t height = (sizey * 2) + 1;
+    qp_internal_fill_pixdata(device, filled ? width * height : MAX(width, height), hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
+    /*
+    Ellipses have the property of 4-way symmetry, so four pixels can be drawn
+    for each computed [dx,dy] given the center coordinates represented by
+    [x,y].
+
+    Consecutive points sharing the same dy (while the curve is mostly
+    horizontal) or the same dx (while it is mostly vertical) are drawn together
+    as runs. For filled ellipses, the rows are filled between their outermost
+    points instead.
+    */
+
+    bool    ret       = true;
+    int16_t run_start = dx;
     for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
         if (delta >= 0) {
+            // The next point moves to the next row, so draw the points so far
+            if (!qp_internal_symmetric_hrun_impl(device, x, y, run_start, dx, dy, filled)) {
+                ret = false;
+                break;
+            }
+            run_start = dx + 1;
             delta += fa * (1 - dy);
             dy--;
         }
         delta += bb * (4 * dx + 6);
     }
+    if (ret && run_start < dx && !qp_internal_symmetric_hrun_impl(device, x, y, run_start, dx - 1, dy, filled)) {
+        ret = false;
+    }
 
-    dx = sizex;
-    dy = 0;
+    dx        = sizex;
+    dy        = 0;
+    run_start = dy;
 
-    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); ret && aa * dy <= bb * dx; dy++) {
         if (delta >= 0) {
+            // The next point moves to the next column, so draw the points so far
+            if (!qp_internal_symmetric_vrun_impl(device, x, y, dx, run_start, dy, filled)) {
+                ret = false;
+                break;
+            }
+            run_start = dy + 1;
             delta += fb * (1 - dx);
             dx--;
         }
         delta += aa * (4 * dy + 6);
     }
+    if (ret && run_start < dy && !qp_internal_symmetric_vrun_impl(device, x, y, dx, run_start, dy - 1, filled)) {
+        ret = false;
+    }
 
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
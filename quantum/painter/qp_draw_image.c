@@ -148,9 +148,6 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Ensure we aren't reusing any palette
-    qp_internal_invalidate_palette();
-
     if (!qp_internal_bpp_capable(info->bpp)) {
         qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
         qp_comms_stop(device);
@@ -158,29 +155,26 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     }
 
     // Handle palette if needed
-    const uint16_t palette_entries  = 1u << info->bpp;
-    bool           needs_pixconvert = false;
+    const uint16_t palette_entries = 1u << info->bpp;
     if (info->has_palette) {
         // Load the palette from the stream
         if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
             return false;
         }
 
-        needs_pixconvert = true;
-    } else {
-        if (info->bpp <= 8) {
-            // Interpolate from fg/bg
-            needs_pixconvert = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-        }
-    }
-
-    if (needs_pixconvert) {
         // Convert the palette to native format
         if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
             qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
             qp_comms_stop(device);
             return false;
         }
+    } else if (info->bpp <= 8) {
+        // Interpolate from fg/bg, reusing a previously converted palette if possible
+        if (!qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, palette_entries)) {
+            qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
+            qp_comms_stop(device);
+            return false;
+        }
     }
 
     // Handle delta if needed
@@ -195,6 +189,11 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         info->top    = delta_descriptor.top;
         info->right  = delta_descriptor.right;
         info->bottom = delta_descriptor.bottom;
+    } else {
+        info->left   = 0;
+        info->top    = 0;
+        info->right  = qgf_image->base.width - 1;
+        info->bottom = qgf_image->base.height - 1;
     }
 
     // Read the data block
@@ -208,6 +207,45 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     return true;
 }
 
+// Reads only the timing and the area of the image a frame covers, without touching the palette or the pixel data.
+static bool qp_drawimage_read_frame_bounds(qgf_image_handle_t *qgf_image, uint16_t frame_number, qgf_frame_info_t *info) {
+    // Seek to the frame and read the frame descriptor
+    qgf_seek_to_frame_descriptor(&qgf_image->stream, frame_number);
+    qgf_frame_v1_t frame_descriptor;
+    if (qp_stream_read(&frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) != 1) {
+        qp_dprintf("Failed to read frame_descriptor, expected length was not %d\n", (int)sizeof(qgf_frame_v1_t));
+        return false;
+    }
+    if (!qgf_parse_frame_descriptor(&frame_descriptor, &info->bpp, &info->has_palette, &info->is_panel_native, &info->is_delta, &info->compression_scheme, &info->delay)) {
+        return false;
+    }
+
+    // Frames without a delta descriptor cover the whole image
+    if (!info->is_delta) {
+        info->left   = 0;
+        info->top    = 0;
+        info->right  = qgf_image->base.width - 1;
+        info->bottom = qgf_image->base.height - 1;
+        return true;
+    }
+
+    // The delta descriptor follows the palette, if there is one
+    if (info->has_palette) {
+        qp_stream_seek(&qgf_image->stream, sizeof(qgf_palette_v1_t) + (1u << info->bpp) * sizeof(qgf_palette_entry_v1_t), SEEK_CUR);
+    }
+    qgf_delta_v1_t delta_descriptor;
+    if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, &qgf_image->stream) != 1) {
+        qp_dprintf("Failed to read delta_descriptor, expected length was not %d\n", (int)sizeof(qgf_delta_v1_t));
+        return false;
+    }
+
+    info->left   = delta_descriptor.left;
+    info->top    = delta_descriptor.top;
+    info->right  = delta_descriptor.right;
+    info->bottom = delta_descriptor.bottom;
+    return true;
+}
+
 static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
     qp_dprintf("qp_drawimage_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -233,18 +271,10 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    uint16_t l, t, r, b;
-    if (frame_info->is_delta) {
-        l = x + frame_info->left;
-        t = y + frame_info->top;
-        r = x + frame_info->right;
-        b = y + frame_info->bottom;
-    } else {
-        l = x;
-        t = y;
-        r = x + image->width - 1;
-        b = y + image->height - 1;
-    }
+    uint16_t l           = x + frame_info->left;
+    uint16_t t           = y + frame_info->top;
+    uint16_t r           = x + frame_info->right;
+    uint16_t b           = y + frame_info->bottom;
     uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
 
     // Configure where we're going to be rendering to
@@ -289,44 +319,161 @@ deferred_token qp_animate(painter_device_t device, uint16_t x, uint16_t y, paint
 // Quantum Painter External API: qp_animate_recolor
 
 typedef struct animation_state_t {
-    painter_device_t       device;
-    uint16_t               x;
-    uint16_t               y;
-    painter_image_handle_t image;
-    qp_pixel_t             fg_hsv888;
-    qp_pixel_t             bg_hsv888;
-    uint16_t               frame_number;
-    deferred_token         defer_token;
+    painter_device_t                device;
+    uint16_t                        x;
+    uint16_t                        y;
+    painter_image_handle_t          image;
+    qp_pixel_t                      fg_hsv888;
+    qp_pixel_t                      bg_hsv888;
+    uint16_t                        frame_number;
+    deferred_token                  defer_token;
+    uint32_t                        frame_due;      // the time the current frame should be shown
+    uint16_t                        rows_drawn;     // rows of the current frame already sent to the display
+    uint32_t                        stream_pos;     // stream position of the current frame's remaining pixel data
+    qp_internal_byte_input_state_t  input_state;    // decoder state of the current frame's remaining pixel data
+    qp_internal_byte_input_callback input_callback; // decoder of the current frame's pixel data
 } animation_state_t;
 
 static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
 static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS]    = {0};
 
-static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
-    qgf_frame_info_t frame_info = {0};
-    qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
-    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
+// Draws the current frame for at most budget_ms milliseconds, carrying on from where the previous call stopped. A budget
+// of zero draws the rest of the frame. Once the whole frame has been drawn, moves on to the next frame and returns its
+// delay through delay_ms -- otherwise delay_ms is left as-is.
+static bool qp_render_animation_state(animation_state_t *state, uint16_t budget_ms, uint16_t *delay_ms) {
+    qgf_frame_info_t    frame_info = {0};
+    painter_driver_t   *driver     = (painter_driver_t *)state->device;
+    qgf_image_handle_t *qgf_image  = (qgf_image_handle_t *)state->image;
+    qp_dprintf("qp_render_animation_state: entry (frame #%d, row %d)\n", (int)state->frame_number, (int)state->rows_drawn);
+    if (!driver || !driver->validate_ok || !qgf_image || !qgf_image->validate_ok) {
+        qp_dprintf("qp_render_animation_state: fail (invalid device or image)\n");
+        return false;
+    }
+
+    // Read the frame info, which also restores the palette in case something else has been drawn in the meantime
+    if (!qp_drawimage_prepare_frame_for_stream_read(state->device, qgf_image, state->frame_number, state->fg_hsv888, state->bg_hsv888, &frame_info)) {
+        qp_dprintf("qp_render_animation_state: fail (could not read frame %d)\n", (int)state->frame_number);
+        return false;
+    }
+
+    if (state->rows_drawn == 0) {
+        // Starting a new frame, so set up the decoder
+        state->input_state    = (qp_internal_byte_input_state_t){.device = state->device, .src_stream = &qgf_image->stream};
+        state->input_callback = qp_internal_prepare_input_state(&state->input_state, frame_info.compression_scheme);
+        if (state->input_callback == NULL) {
+            qp_dprintf("qp_render_animation_state: fail (invalid image compression scheme)\n");
+            return false;
+        }
+    } else {
+        // The image may have been drawn elsewhere since, so go back to where the previous call stopped
+        qp_stream_setpos(&qgf_image->stream, state->stream_pos);
+    }
+
+    // The LZ window is shared by everything being decoded, so LZ frames can't be interrupted
+    if (frame_info.compression_scheme == IMAGE_COMPRESSED_LZ) {
+        budget_ms = 0;
+    }
+
+    if (!qp_comms_start(state->device)) {
+        qp_dprintf("qp_render_animation_state: fail (could not start comms)\n");
+        return false;
+    }
+
+    // Only the remaining rows of the frame are left to draw
+    uint16_t l = state->x + frame_info.left;
+    uint16_t t = state->y + frame_info.top + state->rows_drawn;
+    uint16_t r = state->x + frame_info.right;
+    uint16_t b = state->y + frame_info.bottom;
+    if (!driver->driver_vtable->viewport(state->device, l, t, r, b)) {
+        qp_dprintf("qp_render_animation_state: fail (could not set viewport)\n");
+        qp_comms_stop(state->device);
+        return false;
+    }
+
+    // Decode and stream as many rows as the budget allows
+    uint16_t rows_sent = 0;
+    bool     ret       = qp_internal_appender_rows(state->device, frame_info.bpp, r - l + 1, b - t + 1, budget_ms, &rows_sent, state->input_callback, &state->input_state);
+    qp_comms_stop(state->device);
+
     if (ret) {
-        ++state->frame_number;
-        if (state->frame_number >= state->image->frame_count) {
-            state->frame_number = 0;
+        state->rows_drawn += rows_sent;
+        state->stream_pos = qp_stream_tell(&qgf_image->stream);
+        if (rows_sent == b - t + 1) {
+            // Frame complete, move on to the next one
+            state->rows_drawn = 0;
+            ++state->frame_number;
+            if (state->frame_number >= state->image->frame_count) {
+                state->frame_number = 0;
+            }
+            *delay_ms = frame_info.delay;
         }
-        *delay_ms = frame_info.delay;
     }
-    qp_dprintf("qp_render_animation_state: %s (delay %dms)\n", ret ? "ok" : "fail", (int)(*delay_ms));
+    qp_dprintf("qp_render_animation_state: %s (%d rows, delay %dms)\n", ret ? "ok" : "fail", (int)rows_sent, (int)(*delay_ms));
     return ret;
 }
 
+// Skips over frames that should have already been replaced by the next one, as long as the next frame redraws the
+// merged area of everything that was skipped -- otherwise parts of the skipped frames would go missing.
+static bool qp_skip_overdue_animation_frames(animation_state_t *state) {
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)state->image;
+    qgf_frame_info_t    curr, next;
+    if (!qp_drawimage_read_frame_bounds(qgf_image, state->frame_number, &curr)) {
+        return false;
+    }
+
+    // Note that timer_expired32() doesn't parenthesize its arguments, so the due time is kept separately
+    uint32_t now           = timer_read32();
+    uint32_t next_due      = state->frame_due + curr.delay;
+    uint16_t merged_left   = curr.left;
+    uint16_t merged_top    = curr.top;
+    uint16_t merged_right  = curr.right;
+    uint16_t merged_bottom = curr.bottom;
+    while (timer_expired32(now, next_due)) {
+        uint16_t next_frame = state->frame_number + 1 >= state->image->frame_count ? 0 : state->frame_number + 1;
+        if (next_frame == state->frame_number || !qp_drawimage_read_frame_bounds(qgf_image, next_frame, &next)) {
+            break;
+        }
+        if (next.left > merged_left || next.top > merged_top || next.right < merged_right || next.bottom < merged_bottom) {
+            break;
+        }
+
+        qp_dprintf("qp_skip_overdue_animation_frames: skipping frame #%d\n", (int)state->frame_number);
+        state->frame_number = next_frame;
+        state->frame_due    = next_due;
+        next_due            = state->frame_due + next.delay;
+        merged_left         = MIN(merged_left, next.left);
+        merged_top          = MIN(merged_top, next.top);
+        merged_right        = MAX(merged_right, next.right);
+        merged_bottom       = MAX(merged_bottom, next.bottom);
+    }
+    return true;
+}
+
 static uint32_t animation_callback(uint32_t trigger_time, void *cb_arg) {
     animation_state_t *state    = (animation_state_t *)cb_arg;
     uint16_t           delay_ms = 0;
-    bool               ret      = qp_render_animation_state(state, &delay_ms);
+    bool               ret      = true;
+
+    // Catch up before starting a new frame, if running late
+    if (state->rows_drawn == 0) {
+        ret = qp_skip_overdue_animation_frames(state);
+    }
+    ret = ret && qp_render_animation_state(state, QUANTUM_PAINTER_ANIMATION_SLICE_MS, &delay_ms);
     if (!ret) {
         // Setting the device to NULL clears the animation slot
         state->device = NULL;
+        return 0;
+    }
+
+    // Partially drawn frames carry on during the next pass of the main loop
+    if (state->rows_drawn > 0) {
+        return 1;
     }
-    // If we're successful, keep animating -- returning 0 cancels the deferred execution
-    return ret ? delay_ms : 0;
+
+    // Otherwise wait until the next frame is due, measured from when the finished frame was due so that time spent
+    // drawing doesn't accumulate -- returning 0 cancels the deferred execution, so never return less than 1
+    state->frame_due += delay_ms;
+    return timer_expired32(trigger_time, state->frame_due) ? 1 : state->frame_due - trigger_time;
 }
 
 deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
@@ -353,16 +500,21 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     anim_state->fg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     anim_state->bg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
     anim_state->frame_number = 0;
+    anim_state->frame_due    = timer_read32();
+    anim_state->rows_drawn   = 0;
 
-    // Draw the first frame
-    uint16_t delay_ms;
-    if (!qp_render_animation_state(anim_state, &delay_ms)) {
+    // Draw the first frame in one go
+    uint16_t delay_ms = 0;
+    if (!qp_render_animation_state(anim_state, 0, &delay_ms)) {
         anim_state->device = NULL; // disregard the allocated animation slot
         qp_dprintf("qp_animate_recolor: fail (could not render first frame)\n");
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Set up the timer
+    // Set up the timer, taking into account the time it took to draw the first frame
+    anim_state->frame_due += delay_ms;
+    uint32_t now            = timer_read32();
+    delay_ms                = timer_expired32(now, anim_state->frame_due) ? 1 : anim_state->frame_due - now;
     anim_state->defer_token = defer_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, delay_ms, animation_callback, anim_state);
     if (anim_state->defer_token == INVALID_DEFERRED_TOKEN) {
         anim_state->device = NULL; // disregard the allocated animation slot
@@ -12,6 +12,15 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+// Location and width of a recently used glyph
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point : 24;
+    uint32_t width : 8;
+    uint32_t data_offset;
+} qff_glyph_cache_entry_t;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
@@ -21,6 +30,12 @@ typedef struct qff_font_handle_t {
     bool                  has_palette;
     bool                  is_panel_native;
     painter_compression_t compression_scheme;
+    uint32_t              unicode_table_offset; // stream offset of the first unicode glyph entry
+    uint32_t              glyph_data_offset;    // stream offset of the first byte of glyph data
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    uint8_t                 glyph_cache_count;
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE]; // most recently used first
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -106,6 +121,23 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    // Work out where the unicode table and the glyph data live, so that glyph lookups don't have to
+    uint32_t offset = sizeof(qff_font_descriptor_v1_t);
+    if (font->has_ascii_table) {
+        offset += sizeof(qff_ascii_glyph_table_v1_t);
+    }
+    font->unicode_table_offset = offset + sizeof(qgf_block_header_v1_t);
+    if (font->num_unicode_glyphs > 0) {
+        offset += sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t));
+    }
+    if (font->has_palette) {
+        offset += sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t));
+    }
+    font->glyph_data_offset = offset + sizeof(qgf_block_header_v1_t);
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    font->glyph_cache_count = 0;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -183,8 +215,7 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     }
 
     // Handle palette if needed
-    const uint16_t palette_entries  = 1u << qff_font->bpp;
-    bool           needs_pixconvert = false;
+    const uint16_t palette_entries = 1u << qff_font->bpp;
     if (qff_font->has_palette) {
         // If this font has a palette, we need to read it out and set up the pixel lookup table
         qp_stream_setpos(&qff_font->stream, offset);
@@ -194,27 +225,89 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
 
         // Skip this block, as far as offset calculations go
         offset += sizeof(qgf_palette_v1_t) + (palette_entries * 3);
-        needs_pixconvert = true;
-    } else {
-        // Interpolate from fg/bg
-        int16_t palette_entries = 1 << qff_font->bpp;
-        needs_pixconvert        = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-    }
 
-    if (needs_pixconvert) {
         // Convert the palette to native format
         if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
             qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
             qp_comms_stop(device);
             return false;
         }
+    } else {
+        // Interpolate from fg/bg, reusing a previously converted palette if possible
+        if (!qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, palette_entries)) {
+            qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
+            qp_comms_stop(device);
+            return false;
+        }
     }
 
     *data_offset = offset;
     return true;
 }
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+// Looks up a glyph in the font's cache, moving it to the front if found
+static inline bool qp_drawtext_glyph_cache_lookup(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *data_offset) {
+    for (uint8_t i = 0; i < qff_font->glyph_cache_count; ++i) {
+        if (qff_font->glyph_cache[i].code_point == code_point) {
+            qff_glyph_cache_entry_t entry = qff_font->glyph_cache[i];
+            memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], i * sizeof(qff_glyph_cache_entry_t));
+            qff_font->glyph_cache[0] = entry;
+            *width                   = entry.width;
+            *data_offset             = entry.data_offset;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Adds a glyph to the front of the font's cache, evicting the least recently used glyph if it's full
+static inline void qp_drawtext_glyph_cache_insert(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint32_t data_offset) {
+    if (qff_font->glyph_cache_count < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE) {
+        qff_font->glyph_cache_count++;
+    }
+    memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], (qff_font->glyph_cache_count - 1) * sizeof(qff_glyph_cache_entry_t));
+    qff_font->glyph_cache[0] = (qff_glyph_cache_entry_t){.code_point = code_point, .width = width, .data_offset = data_offset};
+}
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
+// Binary search of the unicode table, which is sorted by code point
+static inline bool qp_drawtext_find_unicode_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *data_offset) {
+    uint16_t lo = 0;
+    uint16_t hi = qff_font->num_unicode_glyphs;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (qp_stream_setpos(&qff_font->stream, qff_font->unicode_table_offset + mid * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+            qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+            return false;
+        }
+
+        qff_unicode_glyph_v1_t glyph_info;
+        if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+            qp_dprintf("Failed to read unicode glyph info\n");
+            return false;
+        }
+
+        if (glyph_info.code_point == code_point) {
+            *width       = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
+            *data_offset = qff_font->glyph_data_offset + ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+            return true;
+        } else if (glyph_info.code_point < code_point) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    // Not found
+    qp_dprintf("Failed to find unicode glyph info\n");
+    return false;
+}
+
 static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    uint8_t  glyph_width;
+    uint32_t data_offset;
+
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,65 +324,31 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        glyph_width = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
+        data_offset = qff_font->glyph_data_offset + ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
-
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+        if (!qp_drawtext_glyph_cache_lookup(qff_font, code_point, &glyph_width, &data_offset)) {
+            if (!qp_drawtext_find_unicode_glyph(qff_font, code_point, &glyph_width, &data_offset)) {
                 return false;
             }
-
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
-            }
+            qp_drawtext_glyph_cache_insert(qff_font, code_point, glyph_width, data_offset);
+        }
+#else  // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+        if (!qp_drawtext_find_unicode_glyph(qff_font, code_point, &glyph_width, &data_offset)) {
+            return false;
         }
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
         return false;
     }
-    return false;
+
+    *width = glyph_width;
+    return true;
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
@@ -352,8 +411,8 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t                  *driver = (painter_driver_t *)state->device;
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+    // Reset the input state's decoder, each glyph is compressed separately -- the stream should already be correctly positioned by qp_iterate_code_points()
+    qp_internal_prepare_input_state(state->input_state, qff_font->compression_scheme);
 
     // Reset the output state
     state->output_state->pixel_write_pos = 0;
@@ -369,6 +428,84 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Text run drawing implementation
+
+// Callback state
+typedef struct code_point_iter_drawrow_state_t {
+    uint8_t                           row;
+    qp_internal_pixel_output_state_t *output_state;
+} code_point_iter_drawrow_state_t;
+
+// Codepoint handler callback: draws a single row of the glyph, for uncompressed fonts using a palette
+static inline bool qp_font_code_point_handler_drawrow(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+    code_point_iter_drawrow_state_t *state = (code_point_iter_drawrow_state_t *)cb_arg;
+
+    // The stream is positioned at the start of the glyph by qp_iterate_code_points(), skip to the start of the row
+    const uint8_t  bpp        = qff_font->bpp;
+    const uint8_t  mask       = (1 << bpp) - 1;
+    const uint32_t bit_offset = ((uint32_t)state->row) * width * bpp;
+    if (qp_stream_seek(&qff_font->stream, bit_offset / 8, SEEK_CUR) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph row\n");
+        return false;
+    }
+
+    // Pixels never straddle bytes, as bpp is one of 1, 2, 4 or 8
+    uint8_t shift   = bit_offset % 8;
+    int16_t byteval = qp_stream_get(&qff_font->stream);
+    for (uint8_t i = 0; i < width; ++i) {
+        if (shift == 8) {
+            byteval = qp_stream_get(&qff_font->stream);
+            shift   = 0;
+        }
+        if (byteval < 0) {
+            return false;
+        }
+        if (!qp_internal_pixel_appender(qp_internal_global_pixel_lookup_table, (byteval >> shift) & mask, state->output_state)) {
+            return false;
+        }
+        shift += bpp;
+    }
+
+    return true;
+}
+
+// Draws the whole string through a single viewport, rasterizing it one row at a time. Only usable when glyph rows can
+// be seeked to, which rules out compressed fonts, and when the glyphs go through the palette lookup table.
+static inline bool qp_drawtext_run(painter_device_t device, uint16_t x, uint16_t y, qff_font_handle_t *qff_font, const char *str, int16_t *width) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // Work out the extent of the run, which also makes sure every glyph exists before anything is sent
+    code_point_iter_calcwidth_state_t calcwidth_state = {.width = 0};
+    if (!qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &calcwidth_state)) {
+        return false;
+    }
+    *width = calcwidth_state.width;
+    if (calcwidth_state.width == 0) {
+        return true;
+    }
+
+    // Configure where we're going to be rendering to
+    if (!driver->driver_vtable->viewport(device, x, y, x + calcwidth_state.width - 1, y + qff_font->base.line_height - 1)) {
+        return false;
+    }
+
+    // Stream each row of the run, the pixel appender sends the buffer whenever it fills up
+    qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
+    code_point_iter_drawrow_state_t  state        = {.row = 0, .output_state = &output_state};
+    for (state.row = 0; state.row < qff_font->base.line_height; ++state.row) {
+        if (!qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawrow, &state)) {
+            return false;
+        }
+    }
+
+    // Any leftovers need transmission as well.
+    if (output_state.pixel_write_pos > 0) {
+        return qp_internal_send_pixdata(device, output_state.pixel_write_pos);
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_textwidth
 
@@ -416,6 +553,25 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return 0;
     }
 
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    uint32_t   data_offset;
+    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
+        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
+        qp_comms_stop(device);
+        return false;
+    }
+
+    // Uncompressed palette fonts can be drawn as a single run, saving a viewport per glyph
+    if (qff_font->compression_scheme == IMAGE_UNCOMPRESSED && qff_font->bpp <= 8) {
+        int16_t width = 0;
+        bool    ret   = qp_drawtext_run(device, x, y, qff_font, str, &width);
+
+        qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
+        qp_comms_stop(device);
+        return ret ? width : 0;
+    }
+
     // Set up the byte input state and input callback
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qff_font->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
@@ -439,15 +595,6 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
                                                // Output
                                                .output_state = &output_state};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
-    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
-        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
     // Iterate the codepoints with the drawglyph callback
     bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
 
@@ -38,12 +38,16 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_busy_func)(painter_device_t device);
 
 typedef struct painter_comms_vtable_t {
     painter_driver_comms_init_func  comms_init;
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+    painter_driver_comms_send_func  comms_send_async; // optional, returns before the transfer completes -- comms_stop and any other comms call wait for it
+    painter_driver_comms_busy_func  comms_busy;       // optional, whether a transfer started by comms_send_async is still in progress
+    painter_driver_comms_stop_func  comms_stop_async; // optional, ends the transaction once the transfer completes without waiting for it, releasing the bus for other devices
 } painter_comms_vtable_t;
 
 typedef bool (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
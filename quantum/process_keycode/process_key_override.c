@@ -88,6 +88,129 @@ static bool enabled = true;
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
+// Trigger index
+
+// key_override_index_overrides holds override indices sorted by trigger keycode, and by position in the override list within a trigger. Overrides with a KC_NO trigger sort first and form the wildcard bucket.
+// It lives in keymap_introspection.c, where the size of key_overrides is known.
+static uint8_t index_count = 0;
+
+// Whether key_override_index_overrides is up to date. When there are more overrides than fit in the index, every override is checked on each event.
+static bool index_built  = false;
+static bool index_usable = false;
+
+#define KEY_OVERRIDE_CANDIDATE_RUNS 3
+#define KEY_OVERRIDE_NO_CANDIDATE 0xFFFF
+
+/** Iterates over the overrides that could activate for an event, in override list order. Each run is a range of key_override_index_overrides with one trigger keycode. */
+typedef struct {
+    uint8_t  pos[KEY_OVERRIDE_CANDIDATE_RUNS];
+    uint8_t  end[KEY_OVERRIDE_CANDIDATE_RUNS];
+    uint8_t  runs;
+    uint16_t next_linear;
+} key_override_candidates_t;
+
+void key_override_index_reset(void) {
+    index_built = false;
+}
+
+static void build_index(void) {
+    const uint16_t count = key_override_count();
+
+    index_built  = true;
+    index_usable = count <= key_override_index_size;
+    index_count  = 0;
+
+    if (!index_usable) {
+        key_override_printf("Key override index too small (%u overrides), falling back to a full search\n", count);
+        return;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        // Insertion sort keeps the list order within a trigger, and the list is small and only sorted once
+        uint8_t pos = index_count++;
+        while (pos > 0 && key_override_index_triggers[pos - 1] > override->trigger) {
+            key_override_index_overrides[pos] = key_override_index_overrides[pos - 1];
+            key_override_index_triggers[pos]  = key_override_index_triggers[pos - 1];
+            pos--;
+        }
+        key_override_index_overrides[pos] = i;
+        key_override_index_triggers[pos]  = override->trigger;
+    }
+}
+
+/** Adds the run of overrides triggered by `trigger` to the candidates, if there are any. */
+static void add_candidate_run(key_override_candidates_t *candidates, const uint16_t trigger) {
+    // Lower bound
+    uint8_t low = 0, high = index_count;
+    while (low < high) {
+        const uint8_t mid = (low + high) / 2;
+        if (key_override_index_triggers[mid] < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    uint8_t end = low;
+    while (end < index_count && key_override_index_triggers[end] == trigger) {
+        end++;
+    }
+
+    if (end > low) {
+        candidates->pos[candidates->runs] = low;
+        candidates->end[candidates->runs] = end;
+        candidates->runs++;
+    }
+}
+
+/** Collects the overrides that can activate for this event. An override activates only if it has no trigger, its trigger was just pressed, or its trigger is the last non-mod key held down. */
+static void find_candidates(key_override_candidates_t *candidates, const uint16_t keycode, const bool key_down) {
+    candidates->runs        = 0;
+    candidates->next_linear = 0;
+
+    if (!index_built) {
+        build_index();
+    }
+    if (!index_usable) {
+        return;
+    }
+
+    add_candidate_run(candidates, KC_NO);
+    if (key_down && keycode != KC_NO) {
+        add_candidate_run(candidates, keycode);
+    }
+    if (last_key_down != KC_NO && last_key_down != keycode) {
+        add_candidate_run(candidates, last_key_down);
+    }
+}
+
+/** Returns the index of the next candidate override in list order, or KEY_OVERRIDE_NO_CANDIDATE. */
+static uint16_t next_candidate(key_override_candidates_t *candidates) {
+    if (!index_usable) {
+        return candidates->next_linear < key_override_count() ? candidates->next_linear++ : KEY_OVERRIDE_NO_CANDIDATE;
+    }
+
+    uint8_t best = KEY_OVERRIDE_CANDIDATE_RUNS;
+    for (uint8_t run = 0; run < candidates->runs; run++) {
+        if (candidates->pos[run] < candidates->end[run] && (best == KEY_OVERRIDE_CANDIDATE_RUNS || key_override_index_overrides[candidates->pos[run]] < key_override_index_overrides[candidates->pos[best]])) {
+            best = run;
+        }
+    }
+
+    if (best == KEY_OVERRIDE_CANDIDATE_RUNS) {
+        return KEY_OVERRIDE_NO_CANDIDATE;
+    }
+
+    return key_override_index_overrides[candidates->pos[best]++];
+}
+
 void key_override_on(void) {
     enabled = true;
     key_override_printf("Key override ON\n");
@@ -244,13 +367,16 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+/** Iterates through the key overrides that could activate for this event and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
 static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
     if (key_override_count() == 0) {
         return true;
     }
 
-    for (uint16_t i = 0; i < key_override_count(); i++) {
+    key_override_candidates_t candidates;
+    find_candidates(&candidates, keycode, key_down);
+
+    for (uint16_t i = next_candidate(&candidates); i != KEY_OVERRIDE_NO_CANDIDATE; i = next_candidate(&candidates)) {
         const key_override_t *const override = key_override_get(i);
 
         // End of array
@@ -31,33 +31,41 @@ static uint16_t active_td;
 
 static tap_dance_state_t tap_dance_states[TAP_DANCE_MAX_SIMULTANEOUS];
 
+// Only the active tap dance can be waiting on its tapping term, so its state and deadline are kept at hand for
+// tap_dance_task() and preprocess_tap_dance() instead of being looked up on every scan.
+static tap_dance_state_t *active_state;
+static uint16_t           active_tapping_term;
+
 static uint16_t last_tap_time;
 
 static tap_dance_state_t *tap_dance_get_or_allocate_state(uint8_t tap_dance_idx, bool allocate) {
-    uint8_t i;
     if (tap_dance_idx >= tap_dance_count()) {
         return NULL;
     }
-    // Search for a state already used for this keycode
-    for (i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
-        if (tap_dance_states[i].in_use && tap_dance_states[i].index == tap_dance_idx) {
-            return &tap_dance_states[i];
+    // States are placed starting at a slot derived from the tap dance index, so unless more dances than slots
+    // collide, an existing state is found on the first probe.
+    uint8_t            i    = tap_dance_idx % TAP_DANCE_MAX_SIMULTANEOUS;
+    tap_dance_state_t *free = NULL;
+    for (uint8_t probe = 0; probe < TAP_DANCE_MAX_SIMULTANEOUS; probe++) {
+        tap_dance_state_t *state = &tap_dance_states[i];
+        if (state->in_use) {
+            if (state->index == tap_dance_idx) {
+                return state;
+            }
+        } else if (!free) {
+            free = state;
+        }
+        if (++i == TAP_DANCE_MAX_SIMULTANEOUS) {
+            i = 0;
         }
     }
-    // No existing state found; bail out if new state allocation is not allowed
-    if (!allocate) {
+    // No existing state found; bail out if new state allocation is not allowed, or no states are available
+    if (!allocate || !free) {
         return NULL;
     }
-    // Search for the first available state
-    for (i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
-        if (!tap_dance_states[i].in_use) {
-            tap_dance_states[i].index  = tap_dance_idx;
-            tap_dance_states[i].in_use = true;
-            return &tap_dance_states[i];
-        }
-    }
-    // No states are available, tap dance won't happen
-    return NULL;
+    free->index  = tap_dance_idx;
+    free->in_use = true;
+    return free;
 }
 
 tap_dance_state_t *tap_dance_get_state(uint8_t tap_dance_idx) {
@@ -174,11 +182,11 @@ bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
 
     if (!active_td || keycode == active_td) return false;
 
-    action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    state  = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(active_td));
-    if (state == NULL) {
+    state = active_state;
+    if (!state->in_use) {
         return false;
     }
+    action                      = tap_dance_get(state->index);
     state->interrupted          = true;
     state->interrupting_keycode = keycode;
     process_tap_dance_action_on_dance_finished(action, state);
@@ -215,6 +223,10 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action, state);
                 active_td = state->finished ? 0 : keycode;
+                if (active_td) {
+                    active_state        = state;
+                    active_tapping_term = GET_TAPPING_TERM(keycode, &(keyrecord_t){});
+                }
             } else {
                 process_tap_dance_action_on_each_release(action, state);
                 if (state->finished) {
@@ -235,11 +247,11 @@ void tap_dance_task(void) {
     tap_dance_action_t *action;
     tap_dance_state_t  *state;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td || timer_elapsed(last_tap_time) <= active_tapping_term) return;
 
-    action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    state  = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(active_td));
-    if (state != NULL && !state->interrupted) {
+    state  = active_state;
+    action = tap_dance_get(state->index);
+    if (state->in_use && !state->interrupted) {
         process_tap_dance_action_on_dance_finished(action, state);
     }
 }
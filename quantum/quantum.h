@@ -71,6 +71,10 @@
 #    include "deferred_exec.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 extern layer_state_t default_layer_state;
 
 #ifndef NO_ACTION_LAYER
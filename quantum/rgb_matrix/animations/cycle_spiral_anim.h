@@ -2,13 +2,13 @@
 RGB_MATRIX_EFFECT(CYCLE_SPIRAL)
 #    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
-static hsv_t CYCLE_SPIRAL_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint8_t time) {
-    hsv.h = dist - time - atan2_8(dy, dx);
+static hsv_t CYCLE_SPIRAL_math(hsv_t hsv, uint8_t angle, uint8_t dist, uint8_t time) {
+    hsv.h = dist - time - angle;
     return hsv;
 }
 
 bool CYCLE_SPIRAL(effect_params_t* params) {
-    return effect_runner_dx_dy_dist(params, &CYCLE_SPIRAL_math);
+    return effect_runner_polar(params, &CYCLE_SPIRAL_math);
 }
 
 #    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
@@ -0,0 +1,20 @@
+#pragma once
+
+#ifdef RGB_MATRIX_LED_POLAR
+
+typedef hsv_t (*polar_f)(hsv_t hsv, uint8_t angle, uint8_t dist, uint8_t time);
+
+bool effect_runner_polar(effect_params_t* params, polar_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    rgb_matrix_hsv_line_t line = {0};
+    uint8_t               time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        rgb_matrix_hsv_line_push(&line, i, effect_func(rgb_matrix_config.hsv, g_led_polar[i].angle, g_led_polar[i].dist, time));
+    }
+    rgb_matrix_hsv_line_flush(&line);
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#endif // RGB_MATRIX_LED_POLAR
@@ -38,6 +38,35 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Keyboards overriding rgb_matrix_hsv_to_rgb() must override this as well
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_span(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_span(hsv, rgb, count);
+}
+
+// Scratch line the generic runners render into, converted to RGB in bulk
+typedef struct {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_HSV_SPAN_SIZE];
+    hsv_t   hsv[RGB_MATRIX_HSV_SPAN_SIZE];
+} rgb_matrix_hsv_line_t;
+
+static void rgb_matrix_hsv_line_flush(rgb_matrix_hsv_line_t *line) {
+    rgb_t rgb[RGB_MATRIX_HSV_SPAN_SIZE];
+    rgb_matrix_hsv_to_rgb_span(line->hsv, rgb, line->count);
+    for (uint8_t j = 0; j < line->count; j++) {
+        rgb_matrix_set_color(line->index[j], rgb[j].r, rgb[j].g, rgb[j].b);
+    }
+    line->count = 0;
+}
+
+static inline void rgb_matrix_hsv_line_push(rgb_matrix_hsv_line_t *line, uint8_t index, hsv_t hsv) {
+    line->index[line->count] = index;
+    line->hsv[line->count]   = hsv;
+    if (++line->count == RGB_MATRIX_HSV_SPAN_SIZE) {
+        rgb_matrix_hsv_line_flush(line);
+    }
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -71,6 +100,9 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_LED_POLAR
+led_polar_t g_led_polar[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_LED_POLAR
 
 #ifndef RGB_MATRIX_FLAG_STEPS
 #    define RGB_MATRIX_FLAG_STEPS {LED_FLAG_ALL, LED_FLAG_KEYLIGHT | LED_FLAG_MODIFIER, LED_FLAG_UNDERGLOW, LED_FLAG_NONE}
@@ -97,6 +129,77 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+// adaptive frame pacing
+#ifdef RGB_MATRIX_LED_PROCESS_BUDGET_US
+// Where timer_read_us() only has millisecond resolution most chunks time as zero, and samples are accumulated until they don't
+typedef uint32_t rgb_pacer_time_t;
+#    define rgb_pacer_now() timer_read_us()
+#    define rgb_pacer_elapsed_us(start) timer_elapsed_us(start)
+
+#    if RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#        define RGB_PACER_INITIAL_LIMIT RGB_MATRIX_LED_PROCESS_LIMIT
+#    else
+#        define RGB_PACER_INITIAL_LIMIT RGB_MATRIX_LED_COUNT
+#    endif
+
+static struct {
+    uint8_t  led_min;   // first LED of the chunk being rendered
+    uint8_t  led_count; // size of the chunk being rendered
+    uint8_t  limit;     // size of the next chunk
+    uint32_t led_cost;  // smoothed render time per LED, in 1/16 us
+    uint32_t sample_us; // render time not yet folded into led_cost
+    uint32_t sample_leds;
+    uint16_t frames;
+    uint16_t fps;
+    uint32_t fps_timer;
+} rgb_pacer = {0, RGB_PACER_INITIAL_LIMIT, RGB_PACER_INITIAL_LIMIT, 0, 0, 0, 0, 0, 0};
+
+static void rgb_pacer_begin(uint8_t iter) {
+    rgb_pacer.led_min   = iter == 0 ? 0 : rgb_pacer.led_min + rgb_pacer.led_count;
+    rgb_pacer.led_count = rgb_pacer.limit;
+}
+
+static void rgb_pacer_update(uint32_t elapsed_us) {
+    // the last chunk of a frame may be cut short, and split halves skip the other half's LEDs
+    struct rgb_matrix_limits_t limits = rgb_matrix_get_limits(0);
+    if (limits.led_max_index > limits.led_min_index) {
+        rgb_pacer.sample_leds += limits.led_max_index - limits.led_min_index;
+    }
+    rgb_pacer.sample_us += elapsed_us;
+
+    // chunks faster than the timer's resolution measure as zero, so wait until the time adds up to something
+    if (!rgb_pacer.sample_us || !rgb_pacer.sample_leds) return;
+
+    uint32_t sample       = (rgb_pacer.sample_us << 4) / rgb_pacer.sample_leds;
+    rgb_pacer.led_cost    = (rgb_pacer.led_cost * 3 + sample) / 4;
+    rgb_pacer.sample_us   = 0;
+    rgb_pacer.sample_leds = 0;
+
+    uint32_t limit = ((uint32_t)RGB_MATRIX_LED_PROCESS_BUDGET_US << 4) / (rgb_pacer.led_cost ? rgb_pacer.led_cost : 1);
+    if (limit < 1) limit = 1;
+    if (limit > RGB_MATRIX_LED_COUNT) limit = RGB_MATRIX_LED_COUNT;
+    rgb_pacer.limit = limit;
+}
+
+static void rgb_pacer_frame(void) {
+    rgb_pacer.frames++;
+    uint32_t elapsed = timer_elapsed32(rgb_pacer.fps_timer);
+    if (elapsed >= 1000) {
+        rgb_pacer.fps       = (uint32_t)rgb_pacer.frames * 1000 / elapsed;
+        rgb_pacer.frames    = 0;
+        rgb_pacer.fps_timer = timer_read32();
+    }
+}
+
+uint8_t rgb_matrix_get_process_limit(void) {
+    return rgb_pacer.limit;
+}
+
+uint16_t rgb_matrix_get_fps(void) {
+    return rgb_pacer.fps;
+}
+#endif // RGB_MATRIX_LED_PROCESS_BUDGET_US
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, rgb_matrix_config);
 
 void eeconfig_force_flush_rgb_matrix(void) {
@@ -335,6 +438,10 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_LED_PROCESS_BUDGET_US
+    rgb_pacer_begin(rgb_effect_params.iter);
+#endif // RGB_MATRIX_LED_PROCESS_BUDGET_US
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -403,6 +510,9 @@ static void rgb_task_flush(uint8_t effect) {
 
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
+#ifdef RGB_MATRIX_LED_PROCESS_BUDGET_US
+    rgb_pacer_frame();
+#endif // RGB_MATRIX_LED_PROCESS_BUDGET_US
 
     // next task
     rgb_task_state = SYNCING;
@@ -417,7 +527,10 @@ void rgb_matrix_task(void) {
         case STARTING:
             rgb_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_LED_PROCESS_BUDGET_US
+            rgb_pacer_time_t render_start = rgb_pacer_now();
+#endif // RGB_MATRIX_LED_PROCESS_BUDGET_US
             rgb_task_render(effect);
             if (effect) {
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
@@ -425,7 +538,11 @@ void rgb_matrix_task(void) {
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
+#ifdef RGB_MATRIX_LED_PROCESS_BUDGET_US
+            rgb_pacer_update(rgb_pacer_elapsed_us(render_start));
+#endif // RGB_MATRIX_LED_PROCESS_BUDGET_US
             break;
+        }
         case FLUSHING:
             rgb_task_flush(effect);
             break;
@@ -454,7 +571,17 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#if defined(RGB_MATRIX_LED_PROCESS_BUDGET_US)
+    // Chunks vary in size, so they are tracked by the pacer rather than derived from iter
+    (void)iter;
+    uint16_t led_max     = rgb_pacer.led_min + rgb_pacer.led_count;
+    limits.led_min_index = rgb_pacer.led_min;
+    limits.led_max_index = led_max > RGB_MATRIX_LED_COUNT ? RGB_MATRIX_LED_COUNT : led_max;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
+    if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
+#    endif
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
 #    if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
@@ -503,9 +630,25 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_LED_POLAR
+// LED positions never change, so the per-LED trigonometry is done once here instead of every frame
+static void rgb_matrix_init_led_polar(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx           = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy           = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_led_polar[i].angle = atan2_8(dy, dx);
+        g_led_polar[i].dist  = sqrt16(dx * dx + dy * dy);
+    }
+}
+#endif // RGB_MATRIX_LED_POLAR
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_LED_POLAR
+    rgb_matrix_init_led_polar();
+#endif // RGB_MATRIX_LED_POLAR
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
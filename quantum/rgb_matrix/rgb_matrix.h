@@ -90,6 +90,10 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifndef RGB_MATRIX_HSV_SPAN_SIZE
+#    define RGB_MATRIX_HSV_SPAN_SIZE 16
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -97,6 +101,11 @@ struct rgb_matrix_limits_t {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
 
+#ifdef RGB_MATRIX_LED_PROCESS_BUDGET_US
+uint8_t  rgb_matrix_get_process_limit(void);
+uint16_t rgb_matrix_get_fps(void);
+#endif
+
 #define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)                   \
     struct rgb_matrix_limits_t limits = rgb_matrix_get_limits(iter); \
     uint8_t                    min    = limits.led_min_index;        \
@@ -302,3 +311,6 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_LED_POLAR
+extern led_polar_t g_led_polar[RGB_MATRIX_LED_COUNT];
+#endif
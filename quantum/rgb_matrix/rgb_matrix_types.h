@@ -57,6 +57,11 @@ typedef struct PACKED {
     uint8_t y;
 } led_point_t;
 
+typedef struct PACKED {
+    uint8_t angle; // atan2_8() of the offset from k_rgb_matrix_center
+    uint8_t dist;  // sqrt16() of the offset from k_rgb_matrix_center
+} led_polar_t;
+
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
 #define HAS_ANY_FLAGS(bits, flags) ((bits & flags) != 0x00)
 
@@ -0,0 +1,82 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+class HsvSpan : public ::testing::Test {};
+
+static bool rgb_equal(rgb_t a, rgb_t b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+TEST_F(HsvSpan, MatchesPerPixelConversion) {
+    hsv_t hsv[256];
+    rgb_t rgb[256];
+    rgb_t rgb_nocie[256];
+
+    for (int s = 0; s < 256; s++) {
+        for (int v = 0; v < 256; v++) {
+            for (int h = 0; h < 256; h++) {
+                hsv[h] = (hsv_t){(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            hsv_to_rgb_span(hsv, rgb, 256);
+            hsv_to_rgb_span_nocie(hsv, rgb_nocie, 256);
+            for (int h = 0; h < 256; h++) {
+                ASSERT_TRUE(rgb_equal(rgb[h], hsv_to_rgb(hsv[h]))) << "h=" << h << " s=" << s << " v=" << v;
+                ASSERT_TRUE(rgb_equal(rgb_nocie[h], hsv_to_rgb_nocie(hsv[h]))) << "h=" << h << " s=" << s << " v=" << v;
+            }
+        }
+    }
+}
+
+TEST_F(HsvSpan, RepeatedColorsAreCopied) {
+    hsv_t hsv[4] = {{HSV_RED}, {HSV_RED}, {HSV_OFF}, {HSV_OFF}};
+    rgb_t rgb[4];
+
+    hsv_to_rgb_span(hsv, rgb, 4);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(rgb_equal(rgb[i], hsv_to_rgb(hsv[i])));
+    }
+}
+
+TEST_F(HsvSpan, Benchmark) {
+    // Mimics a rainbow effect over a large board: every pixel has a distinct hue
+    const size_t       leds   = 128;
+    const int          frames = 20000;
+    std::vector<hsv_t> hsv(leds);
+    std::vector<rgb_t> rgb(leds);
+    uint32_t           checksum = 0;
+
+    for (size_t i = 0; i < leds; i++) {
+        hsv[i] = (hsv_t){(uint8_t)(i * 2), 255, 200};
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        hsv[f % leds].h++;
+        for (size_t i = 0; i < leds; i++) {
+            rgb[i] = hsv_to_rgb(hsv[i]);
+        }
+        checksum += rgb[f % leds].r;
+    }
+    auto per_pixel = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        hsv[f % leds].h++;
+        hsv_to_rgb_span(hsv.data(), rgb.data(), leds);
+        checksum += rgb[f % leds].r;
+    }
+    auto span = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    RecordProperty("per_pixel_ns", (int)(per_pixel / (frames * leds)));
+    RecordProperty("span_ns", (int)(span / (frames * leds)));
+    printf("hsv_to_rgb: %.2f ns/pixel, hsv_to_rgb_span: %.2f ns/pixel (checksum %u)\n", (double)per_pixel / (frames * leds), (double)span / (frames * leds), checksum);
+}
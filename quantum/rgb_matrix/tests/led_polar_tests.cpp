@@ -0,0 +1,193 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+led_config_t g_led_config;
+
+static rgb_t    leds[RGB_MATRIX_LED_COUNT];
+static uint32_t flushes;
+
+static void test_driver_init(void) {}
+
+static void test_driver_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds[index] = (rgb_t){r, g, b};
+}
+
+static void test_driver_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        leds[i] = (rgb_t){r, g, b};
+    }
+}
+
+static void test_driver_flush(void) {
+    flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_driver_init,
+    .set_color     = test_driver_set_color,
+    .set_color_all = test_driver_set_color_all,
+    .flush         = test_driver_flush,
+};
+
+void eeconfig_read_rgb_matrix(rgb_config_t *rgb_matrix_config) {
+    memset(rgb_matrix_config, 0, sizeof(rgb_config_t));
+}
+
+void eeconfig_update_rgb_matrix(const rgb_config_t *rgb_matrix_config) {}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+void advance_time(uint32_t ms);
+}
+
+// The default center of the 224x64 coordinate space
+static const int16_t center_x = 112;
+static const int16_t center_y = 32;
+
+// CYCLE_SPIRAL as it was before the conversion to effect_runner_polar()
+static hsv_t spiral_dx_dy(hsv_t hsv, int16_t dx, int16_t dy, uint8_t time) {
+    hsv.h = sqrt16(dx * dx + dy * dy) - time - atan2_8(dy, dx);
+    return hsv;
+}
+
+class LedPolar : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // 16x8 grid spread over the full 224x64 coordinate space, one LED per key
+        for (uint8_t y = 0; y < MATRIX_ROWS; y++) {
+            for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+                uint8_t i                    = y * MATRIX_COLS + x;
+                g_led_config.matrix_co[y][x] = i;
+                g_led_config.point[i]        = (led_point_t){(uint8_t)(x * 224 / (MATRIX_COLS - 1)), (uint8_t)(y * 64 / (MATRIX_ROWS - 1))};
+                g_led_config.flags[i]        = LED_FLAG_KEYLIGHT;
+            }
+        }
+        // A few LEDs on known bearings from the center
+        g_led_config.point[0]  = (led_point_t){112, 32};
+        g_led_config.point[1]  = (led_point_t){224, 32};
+        g_led_config.point[2]  = (led_point_t){112, 64};
+        g_led_config.point[3]  = (led_point_t){0, 32};
+        g_led_config.point[4]  = (led_point_t){112, 0};
+        g_led_config.point[5]  = (led_point_t){144, 64};
+        g_led_config.point[6]  = (led_point_t){0, 0};
+        g_led_config.point[7]  = (led_point_t){224, 64};
+        g_led_config.flags[8]  = LED_FLAG_UNDERGLOW;
+        g_led_config.flags[64] = LED_FLAG_UNDERGLOW;
+
+        rgb_matrix_init();
+    }
+
+    void SetUp() override {
+        rgb_matrix_config.flags = LED_FLAG_ALL;
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_set_speed_noeeprom(128);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_SPIRAL);
+    }
+
+    // Runs the task until a whole frame has been sent to the driver
+    void render_frame() {
+        uint32_t previous = flushes;
+        for (int i = 0; i < 1000 && flushes == previous; i++) {
+            advance_time(1);
+            rgb_matrix_task();
+        }
+        ASSERT_NE(flushes, previous) << "no frame was flushed";
+    }
+
+    static bool rgb_equal(rgb_t a, rgb_t b) {
+        return a.r == b.r && a.g == b.g && a.b == b.b;
+    }
+};
+
+TEST_F(LedPolar, TableHoldsKnownBearings) {
+    EXPECT_EQ(g_led_polar[0].dist, 0);
+    EXPECT_EQ(g_led_polar[1].angle, 0);
+    EXPECT_EQ(g_led_polar[1].dist, 112);
+    EXPECT_EQ(g_led_polar[2].angle, 64);
+    EXPECT_EQ(g_led_polar[2].dist, 32);
+    EXPECT_EQ(g_led_polar[3].angle, 128);
+    EXPECT_EQ(g_led_polar[3].dist, 112);
+    EXPECT_EQ(g_led_polar[4].angle, 192);
+    EXPECT_EQ(g_led_polar[4].dist, 32);
+    EXPECT_EQ(g_led_polar[5].angle, 32);
+    EXPECT_EQ(g_led_polar[5].dist, 45);
+}
+
+TEST_F(LedPolar, TableMatchesLedPositions) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        double dx = g_led_config.point[i].x - center_x;
+        double dy = g_led_config.point[i].y - center_y;
+
+        // The corners are the furthest from the center, and still fit in eight bits
+        EXPECT_EQ(g_led_polar[i].dist, (uint8_t)std::sqrt(dx * dx + dy * dy)) << "led " << (int)i;
+
+        // atan2_8() is a linear approximation, good to a few 256ths of a turn
+        int angle = (int)std::lround(std::atan2(dy, dx) * 128 / M_PI) & 0xFF;
+        int error = (int8_t)(uint8_t)(g_led_polar[i].angle - angle);
+        EXPECT_LE(std::abs(error), 6) << "led " << (int)i;
+    }
+}
+
+TEST_F(LedPolar, RunnerMatchesPerLedMath) {
+    hsv_t hsv = rgb_matrix_get_hsv();
+    for (int frame = 0; frame < 64; frame++) {
+        memset(leds, 0, sizeof(leds));
+        render_frame();
+
+        uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            int16_t dx = g_led_config.point[i].x - center_x;
+            int16_t dy = g_led_config.point[i].y - center_y;
+            ASSERT_TRUE(rgb_equal(leds[i], hsv_to_rgb(spiral_dx_dy(hsv, dx, dy, time)))) << "led " << (int)i << " frame " << frame;
+        }
+    }
+}
+
+TEST_F(LedPolar, RunnerSkipsFilteredLeds) {
+    rgb_matrix_config.flags = LED_FLAG_KEYLIGHT;
+    memset(leds, 0xFF, sizeof(leds));
+    render_frame();
+
+    for (uint8_t i : {8, 64}) {
+        EXPECT_TRUE(rgb_equal(leds[i], (rgb_t){0, 0, 0})) << "led " << (int)i;
+    }
+}
+
+TEST_F(LedPolar, Benchmark) {
+    const int frames   = 20000;
+    uint32_t  checksum = 0;
+    hsv_t     hsv      = rgb_matrix_get_hsv();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            int16_t dx = g_led_config.point[i].x - center_x;
+            int16_t dy = g_led_config.point[i].y - center_y;
+            checksum += spiral_dx_dy(hsv, dx, dy, f).h;
+        }
+    }
+    auto per_frame = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            checksum += (uint8_t)(g_led_polar[i].dist - f - g_led_polar[i].angle);
+        }
+    }
+    auto table = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    RecordProperty("per_frame_ns", (int)(per_frame / (frames * RGB_MATRIX_LED_COUNT)));
+    RecordProperty("table_ns", (int)(table / (frames * RGB_MATRIX_LED_COUNT)));
+    printf("atan2_8+sqrt16: %.2f ns/led, polar table: %.2f ns/led (checksum %u)\n", (double)per_frame / (frames * RGB_MATRIX_LED_COUNT), (double)table / (frames * RGB_MATRIX_LED_COUNT), checksum);
+}
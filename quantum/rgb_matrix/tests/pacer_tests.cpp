@@ -0,0 +1,126 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "timer.h"
+
+led_config_t g_led_config;
+
+// Render time charged for every LED the effect sets
+static uint32_t led_cost_us;
+static uint32_t leds_set;
+static uint32_t flushes;
+
+void advance_time(uint32_t ms);
+void advance_time_us(uint32_t us);
+
+static void test_driver_init(void) {}
+
+static void test_driver_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds_set++;
+    advance_time_us(led_cost_us);
+}
+
+static void test_driver_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+
+static void test_driver_flush(void) {
+    flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_driver_init,
+    .set_color     = test_driver_set_color,
+    .set_color_all = test_driver_set_color_all,
+    .flush         = test_driver_flush,
+};
+
+void eeconfig_read_rgb_matrix(rgb_config_t *rgb_matrix_config) {
+    memset(rgb_matrix_config, 0, sizeof(rgb_config_t));
+}
+
+void eeconfig_update_rgb_matrix(const rgb_config_t *rgb_matrix_config) {}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+}
+
+class Pacer : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_led_config.flags[i] = LED_FLAG_KEYLIGHT;
+        }
+        rgb_matrix_init();
+    }
+
+    void SetUp() override {
+        rgb_matrix_config.flags = LED_FLAG_ALL;
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    }
+
+    // Runs the task once a millisecond, returning the most LEDs rendered by a single run
+    uint32_t run_for(uint32_t ms) {
+        uint32_t largest_chunk = 0;
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            leds_set = 0;
+            rgb_matrix_task();
+            largest_chunk = std::max(largest_chunk, leds_set);
+        }
+        return largest_chunk;
+    }
+};
+
+TEST_F(Pacer, ChunkShrinksOverBudget) {
+    led_cost_us = 10;
+    run_for(2000);
+
+    // 500us at 10us per LED, give or take the rounding of the smoothed cost
+    EXPECT_NEAR(rgb_matrix_get_process_limit(), 50, 1);
+    EXPECT_LE(run_for(1000), 51);
+}
+
+TEST_F(Pacer, ChunkGrowsBackWithSlack) {
+    led_cost_us = 10;
+    run_for(2000);
+    ASSERT_LT(rgb_matrix_get_process_limit(), RGB_MATRIX_LED_COUNT);
+
+    led_cost_us = 1;
+    run_for(2000);
+    EXPECT_EQ(rgb_matrix_get_process_limit(), RGB_MATRIX_LED_COUNT);
+    EXPECT_EQ(run_for(1000), RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(Pacer, FpsCountsFlushedFrames) {
+    for (uint32_t cost : {1, 10, 40}) {
+        led_cost_us = cost;
+        run_for(3000);
+
+        // Rendering adds its cost on top of the millisecond per task run
+        flushes        = 0;
+        uint32_t start = timer_read32();
+        run_for(10000);
+        uint32_t expected = flushes * 1000 / timer_elapsed32(start);
+
+        EXPECT_NEAR(rgb_matrix_get_fps(), expected, 1) << cost << "us per LED";
+    }
+}
+
+TEST_F(Pacer, FrameRateDropsWithCost) {
+    led_cost_us = 1;
+    run_for(3000);
+    uint16_t cheap_fps = rgb_matrix_get_fps();
+
+    led_cost_us = 40;
+    run_for(3000);
+    EXPECT_LT(rgb_matrix_get_fps(), cheap_fps);
+    // 128 LEDs in chunks of 12, one chunk per task run
+    EXPECT_LE(run_for(1000), 13);
+}
@@ -0,0 +1,31 @@
+rgb_matrix_hsv_span_DEFS := -DUSE_CIE1931_CURVE
+
+rgb_matrix_hsv_span_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/hsv_span_tests.cpp \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/led_tables.c
+
+rgb_matrix_led_polar_DEFS := -DMATRIX_ROWS=8 -DMATRIX_COLS=16 -DRGB_MATRIX_LED_COUNT=128 -DRGB_MATRIX_ENABLE -DENABLE_RGB_MATRIX_CYCLE_SPIRAL -DRGB_MATRIX_LED_POLAR -DUSE_CIE1931_CURVE
+rgb_matrix_led_polar_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners
+
+rgb_matrix_led_polar_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/led_polar_tests.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/led_tables.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+rgb_matrix_pacer_DEFS := -DMATRIX_ROWS=8 -DMATRIX_COLS=16 -DRGB_MATRIX_LED_COUNT=128 -DRGB_MATRIX_ENABLE -DRGB_MATRIX_LED_PROCESS_BUDGET_US=500
+rgb_matrix_pacer_INC := $(rgb_matrix_led_polar_INC)
+
+rgb_matrix_pacer_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/pacer_tests.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/led_tables.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -0,0 +1,3 @@
+TEST_LIST += rgb_matrix_hsv_span
+TEST_LIST += rgb_matrix_led_polar
+TEST_LIST += rgb_matrix_pacer
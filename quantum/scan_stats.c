@@ -0,0 +1,156 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "scan_stats.h"
+
+#ifdef SCAN_STATS_ENABLE
+#    include <inttypes.h>
+#    include <string.h>
+#    include "keyboard.h"
+#    include "timer.h"
+#    include "debug.h"
+
+static scan_stats_t last_window;
+
+static bool     started = false;
+// All in timer_read_us() time
+static uint32_t window_start;
+static uint32_t scan_start;
+static uint32_t last_mark;
+
+static uint32_t scans;
+static uint16_t period_min;
+static uint16_t period_max;
+static uint32_t period_buckets[SCAN_STATS_PERIOD_BUCKETS];
+static uint16_t task_max[SCAN_STATS_TASK_COUNT];
+
+static void clear_window(uint32_t now) {
+    window_start = now;
+    scans        = 0;
+    period_min   = UINT16_MAX;
+    period_max   = 0;
+    memset(period_buckets, 0, sizeof(period_buckets));
+    memset(task_max, 0, sizeof(task_max));
+}
+
+static uint16_t saturate_u16(uint32_t value) {
+    return value > UINT16_MAX ? UINT16_MAX : value;
+}
+
+// Buckets 0-3 hold 0-3us, then each power of two is split into four
+static uint8_t period_bucket(uint16_t period) {
+    if (period < 4) {
+        return period;
+    }
+    uint8_t msb = 2;
+    while (period >> (msb + 1)) {
+        msb++;
+    }
+    uint8_t bucket = (msb - 1) * 4 + ((period >> (msb - 2)) & 3);
+    return bucket < SCAN_STATS_PERIOD_BUCKETS ? bucket : SCAN_STATS_PERIOD_BUCKETS - 1;
+}
+
+// The first period past the end of the bucket
+static uint32_t period_bucket_end(uint8_t bucket) {
+    if (bucket < 4) {
+        return bucket + 1;
+    }
+    uint8_t shift = bucket / 4 - 1;
+    return (uint32_t)(4 + bucket % 4 + 1) << shift;
+}
+
+static uint16_t period_percentile(uint8_t percent) {
+    uint32_t threshold  = (scans * percent + 99) / 100;
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < SCAN_STATS_PERIOD_BUCKETS - 1; i++) {
+        cumulative += period_buckets[i];
+        if (cumulative >= threshold) {
+            uint32_t end = period_bucket_end(i) - 1;
+            return end < period_max ? end : period_max;
+        }
+    }
+    return period_max;
+}
+
+static void close_window(uint32_t now) {
+    uint32_t elapsed = TIMER_DIFF_32(now, window_start);
+
+    last_window = (scan_stats_t){
+        .scans         = scans,
+        .window        = saturate_u16(elapsed / 1000),
+        .period_avg_us = saturate_u16(elapsed / scans),
+        .period_min    = period_min,
+        .period_max    = period_max,
+        .period_p50    = period_percentile(50),
+        .period_p90    = period_percentile(90),
+        .period_p99    = period_percentile(99),
+    };
+    for (uint8_t task = 0; task < SCAN_STATS_TASK_COUNT; task++) {
+        if (task_max[task] > last_window.worst_task_time) {
+            last_window.worst_task_time = task_max[task];
+            last_window.worst_task      = task;
+        }
+    }
+
+#    if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
+    dprintf("matrix scan frequency: %" PRIu32 "\n", get_matrix_scan_rate());
+    dprintf("  period: avg %u min %u p50 %u p90 %u p99 %u max %uus, worst task %u: %uus\n", last_window.period_avg_us, last_window.period_min, last_window.period_p50, last_window.period_p90, last_window.period_p99, last_window.period_max, last_window.worst_task, last_window.worst_task_time);
+#    endif
+
+    clear_window(now);
+}
+
+void scan_stats_task(void) {
+    uint32_t now = timer_read_us();
+
+    if (!started) {
+        started = true;
+        clear_window(now);
+    } else {
+        uint16_t period = saturate_u16(TIMER_DIFF_32(now, scan_start));
+        if (period < period_min) {
+            period_min = period;
+        }
+        if (period > period_max) {
+            period_max = period;
+        }
+        period_buckets[period_bucket(period)]++;
+        scans++;
+
+        scan_stats_mark(SCAN_STATS_TASK_MAIN_LOOP);
+
+        if (TIMER_DIFF_32(now, window_start) >= SCAN_STATS_WINDOW * 1000UL) {
+            close_window(now);
+        }
+    }
+
+    scan_start = now;
+    last_mark  = now;
+}
+
+void scan_stats_mark(scan_stats_task_t task) {
+    uint32_t now     = timer_read_us();
+    uint16_t elapsed = saturate_u16(TIMER_DIFF_32(now, last_mark));
+
+    if (elapsed > task_max[task]) {
+        task_max[task] = elapsed;
+    }
+    last_mark = now;
+}
+
+const scan_stats_t *scan_stats_get(void) {
+    return &last_window;
+}
+
+void scan_stats_reset(void) {
+    memset(&last_window, 0, sizeof(last_window));
+    started = false;
+}
+
+uint32_t get_matrix_scan_rate(void) {
+    if (!last_window.window) {
+        return 0;
+    }
+    return last_window.scans * 1000 / last_window.window;
+}
+#endif
@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// DEBUG_MATRIX_SCAN_RATE predates the scan statistics and is now built on them
+#if defined(DEBUG_MATRIX_SCAN_RATE) && !defined(SCAN_STATS_ENABLE)
+#    define SCAN_STATS_ENABLE
+#endif
+
+/** \brief Length of a statistics window, in milliseconds. */
+#ifndef SCAN_STATS_WINDOW
+#    define SCAN_STATS_WINDOW 1000
+#endif
+
+/**
+ * \brief Number of scan period buckets used for percentiles.
+ *
+ * Buckets 0-3 count periods of 0-3us, after that every doubling of the period is split into four buckets, so the
+ * default of 56 goes up to 32ms. The last bucket counts every longer period.
+ */
+#ifndef SCAN_STATS_PERIOD_BUCKETS
+#    define SCAN_STATS_PERIOD_BUCKETS 56
+#endif
+
+/** \brief The parts of the main loop that are timed separately. */
+typedef enum {
+    SCAN_STATS_TASK_MATRIX,    // matrix scan and key processing
+    SCAN_STATS_TASK_QUANTUM,   // tap dance, combos, leader, host and other quantum tasks
+    SCAN_STATS_TASK_LIGHTING,  // backlight, RGB Light, RGB and LED Matrix
+    SCAN_STATS_TASK_INPUT,     // encoders and pointing devices
+    SCAN_STATS_TASK_DISPLAY,   // OLED and ST7565 displays
+    SCAN_STATS_TASK_OTHER,     // the rest of keyboard_task()
+    SCAN_STATS_TASK_MAIN_LOOP, // protocol, housekeeping and everything else outside of keyboard_task()
+    SCAN_STATS_TASK_COUNT,
+} scan_stats_task_t;
+
+/**
+ * \brief Statistics of one window.
+ *
+ * Times are taken with `timer_read_us()`, so on platforms without a clock finer than the millisecond timer they are
+ * whole milliseconds. Percentiles are the upper bound of their bucket, capped at the longest period. Times of 65535us
+ * or longer are reported as 65535.
+ */
+typedef struct {
+    uint32_t scans;           // number of scans
+    uint16_t window;          // actual length of the window in ms
+    uint16_t period_avg_us;   // average scan period in us
+    uint16_t period_min;      // shortest scan period in us
+    uint16_t period_max;      // longest scan period in us
+    uint16_t period_p50;      // median scan period in us
+    uint16_t period_p90;      // 90th percentile scan period in us
+    uint16_t period_p99;      // 99th percentile scan period in us
+    uint16_t worst_task_time; // longest single run of any task in us
+    uint8_t  worst_task;      // the scan_stats_task_t that took worst_task_time
+} scan_stats_t;
+
+#ifdef SCAN_STATS_ENABLE
+
+/** \brief Starts a new scan. Called at the start of `keyboard_task()`. */
+void scan_stats_task(void);
+
+/** \brief Attributes the time since the previous mark to the given task. */
+void scan_stats_mark(scan_stats_task_t task);
+
+/** \brief Returns the statistics of the last complete window. All zero until the first window completes. */
+const scan_stats_t *scan_stats_get(void);
+
+/** \brief Discards the current and last window, a new window starts with the next scan. */
+void scan_stats_reset(void);
+
+#else
+#    define scan_stats_task()
+#    define scan_stats_mark(task)
+#endif
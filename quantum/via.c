@@ -36,6 +36,9 @@
 #include "wait.h"
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 #include "nvm_via.h"
+#include "action.h"
+#include "action_tapping.h"
+#include "scan_stats.h"
 
 #if defined(SECURE_ENABLE)
 #    include "secure.h"
@@ -232,6 +235,7 @@ __attribute__((weak)) void via_custom_value_command_kb(uint8_t *data, uint8_t le
 //      id_qmk_rgb_matrix_channel   ->  via_qmk_rgb_matrix_command()
 //      id_qmk_led_matrix_channel   ->  via_qmk_led_matrix_command()
 //      id_qmk_audio_channel        ->  via_qmk_audio_command()
+//      id_custom_channel           ->  via_qmk_stats_command(), then via_custom_value_command_kb()
 //
 __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t length) {
     // data = [ command_id, channel_id, value_id, value_data ]
@@ -272,6 +276,12 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     }
 #endif // AUDIO_ENABLE
 
+#if !defined(NO_ACTION_TAPPING) || defined(SCAN_STATS_ENABLE)
+    if (*channel_id == id_custom_channel && via_qmk_stats_command(data, length)) {
+        return;
+    }
+#endif
+
     (void)channel_id; // force use of variable
 
     // If we haven't returned before here, then let the keyboard level code
@@ -885,3 +895,66 @@ void via_qmk_audio_save(void) {
 }
 
 #endif // QMK_AUDIO_ENABLE
+
+#if !defined(NO_ACTION_TAPPING) || defined(SCAN_STATS_ENABLE)
+
+// Returns false for value IDs that are not statistics, so they reach via_custom_value_command_kb()
+bool via_qmk_stats_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id = &(data[0]);
+    uint8_t *value_id   = &(data[2]);
+    uint8_t *value_data = &(data[3]);
+
+    switch (*value_id) {
+#    if !defined(NO_ACTION_TAPPING)
+        case id_qmk_tapping_buffer_stats: {
+            if (*command_id == id_custom_get_value) {
+                uint16_t overflows = waiting_buffer_get_overflows();
+                value_data[0]      = waiting_buffer_get_high_water();
+                value_data[1]      = WAITING_BUFFER_SIZE - 1;
+                value_data[2]      = overflows >> 8;
+                value_data[3]      = overflows & 0xFF;
+            } else if (*command_id == id_custom_set_value) {
+                waiting_buffer_reset_stats();
+            }
+            return true;
+        }
+#    endif
+#    if defined(SCAN_STATS_ENABLE)
+        case id_qmk_scan_stats: {
+            if (*command_id == id_custom_get_value) {
+                const scan_stats_t *stats = scan_stats_get();
+                value_data[0]             = (stats->scans >> 24) & 0xFF;
+                value_data[1]             = (stats->scans >> 16) & 0xFF;
+                value_data[2]             = (stats->scans >> 8) & 0xFF;
+                value_data[3]             = stats->scans & 0xFF;
+                value_data[4]             = stats->window >> 8;
+                value_data[5]             = stats->window & 0xFF;
+                value_data[6]             = stats->period_avg_us >> 8;
+                value_data[7]             = stats->period_avg_us & 0xFF;
+                value_data[8]             = stats->period_min >> 8;
+                value_data[9]             = stats->period_min & 0xFF;
+                value_data[10]            = stats->period_max >> 8;
+                value_data[11]            = stats->period_max & 0xFF;
+                value_data[12]            = stats->period_p50 >> 8;
+                value_data[13]            = stats->period_p50 & 0xFF;
+                value_data[14]            = stats->period_p90 >> 8;
+                value_data[15]            = stats->period_p90 & 0xFF;
+                value_data[16]            = stats->period_p99 >> 8;
+                value_data[17]            = stats->period_p99 & 0xFF;
+                value_data[18]            = stats->worst_task;
+                value_data[19]            = stats->worst_task_time >> 8;
+                value_data[20]            = stats->worst_task_time & 0xFF;
+            } else if (*command_id == id_custom_set_value) {
+                scan_stats_reset();
+            }
+            return true;
+        }
+#    endif
+        default: {
+            return false;
+        }
+    }
+}
+
+#endif // NO_ACTION_TAPPING || SCAN_STATS_ENABLE
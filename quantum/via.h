@@ -123,6 +123,13 @@ enum via_qmk_audio_value {
     id_qmk_audio_clicky_enable = 2,
 };
 
+// Read-only statistics on id_custom_channel, counting down from the top to stay clear of keyboard custom values.
+// Setting a value resets it.
+enum via_qmk_stats_value {
+    id_qmk_tapping_buffer_stats = 0xFF,
+    id_qmk_scan_stats           = 0xFE,
+};
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void);
@@ -188,3 +195,7 @@ void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
 #endif
+
+#if !defined(NO_ACTION_TAPPING) || defined(SCAN_STATS_ENABLE)
+bool via_qmk_stats_command(uint8_t *data, uint8_t length);
+#endif
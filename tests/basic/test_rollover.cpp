@@ -0,0 +1,179 @@
+/* Copyright 2026 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+using testing::SaveArg;
+
+class Rollover : public TestFixture {
+   protected:
+    std::vector<KeymapKey> keys;
+
+    void SetUp() override {
+        const uint16_t codes[] = {KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H};
+        for (uint8_t i = 0; i < 8; i++) {
+            keys.emplace_back(0, i, 0, codes[i]);
+            add_key(keys.back());
+        }
+    }
+
+    /* Presses keys one scan at a time so the press order is known. */
+    void press(TestDriver& driver, std::initializer_list<uint8_t> indices) {
+        for (auto i : indices) {
+            EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AtMost(1));
+            keys[i].press();
+            run_one_scan_loop();
+            VERIFY_AND_CLEAR(driver);
+        }
+    }
+};
+
+TEST_F(Rollover, SeventhKeyIsReportedOnceASlotFrees) {
+    TestDriver driver;
+
+    press(driver, {0, 1, 2, 3, 4, 5});
+
+    EXPECT_NO_REPORT(driver);
+    keys[6].press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(is_key_pressed(KC_A));
+    EXPECT_TRUE(is_key_pressed(KC_G));
+
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_D, KC_E, KC_F, KC_G));
+    keys[0].release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C, KC_D, KC_E, KC_F, KC_G));
+    keys[1].release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(5);
+    for (uint8_t i = 2; i < 7; i++) {
+        keys[i].release();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(has_anykey());
+    EXPECT_EQ(get_first_key(), KC_NO);
+}
+
+TEST_F(Rollover, HeldKeysKeepTheirSlots) {
+    TestDriver        driver;
+    report_keyboard_t report;
+
+    press(driver, {0, 1, 2});
+
+    keys[0].release();
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillOnce(SaveArg<0>(&report));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(report.keys[0], KC_NO);
+    EXPECT_EQ(report.keys[1], KC_B);
+    EXPECT_EQ(report.keys[2], KC_C);
+
+    keys[3].press();
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillOnce(SaveArg<0>(&report));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(report.keys[0], KC_D);
+    EXPECT_EQ(report.keys[1], KC_B);
+    EXPECT_EQ(report.keys[2], KC_C);
+
+    keys[1].release();
+    keys[2].release();
+    keys[3].release();
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(3);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Rollover, OverflowKeysFillFreedSlotsLowestFirst) {
+    TestDriver        driver;
+    report_keyboard_t report;
+
+    press(driver, {7, 6, 5, 4, 3, 2, 1, 0});
+    EXPECT_TRUE(has_anykey());
+    EXPECT_EQ(get_first_key(), KC_A);
+
+    // H, G, F, E, D and C made it into the report, releasing F then H lets A and then B in
+    keys[7].release();
+    keys[5].release();
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(2).WillRepeatedly(SaveArg<0>(&report));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    const uint8_t expected[] = {KC_B, KC_G, KC_A, KC_E, KC_D, KC_C};
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        EXPECT_EQ(report.keys[i], expected[i]);
+    }
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(6);
+    for (auto i : {0, 1, 2, 3, 4, 6}) {
+        keys[i].release();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Rollover, DuplicateKeycodeIsReleasedWithEitherKey) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a  = KeymapKey(0, 0, 0, KC_A);
+    auto       key_a2 = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({key_a, key_a2});
+
+    // Pressing a keycode that is already held re-registers it
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    key_a2.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a2.release();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Rollover, ClearKeyboardDropsOverflowKeys) {
+    TestDriver driver;
+
+    press(driver, {0, 1, 2, 3, 4, 5, 6, 7});
+
+    EXPECT_EMPTY_REPORT(driver);
+    clear_keyboard();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(is_key_pressed(KC_H));
+
+    EXPECT_NO_REPORT(driver);
+    for (auto& key : keys) {
+        key.release();
+    }
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,249 @@
+/* Copyright 2026 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdlib>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+void advance_time(uint32_t ms);
+}
+
+struct fire_t {
+    uint32_t now;
+    uint32_t trigger_time;
+    uintptr_t id;
+};
+
+static std::vector<fire_t> fired;
+static uint32_t            repeat_delay = 0;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    fired.push_back({timer_read32(), trigger_time, (uintptr_t)cb_arg});
+    return repeat_delay;
+}
+
+class DeferredExec : public TestFixture {
+   protected:
+    void SetUp() override {
+        fired.clear();
+        repeat_delay = 0;
+    }
+
+    /* Advances time one millisecond at a time, running the task after each step like the main loop does. */
+    template <size_t N>
+    void run_for(deferred_executor_t (&table)[N], uint32_t ms) {
+        for (uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, N, &last_exec);
+        }
+    }
+
+    uint32_t last_exec = 0;
+};
+
+TEST_F(DeferredExec, FiresInTriggerOrder) {
+    deferred_executor_t table[4] = {0};
+
+    EXPECT_NE(defer_exec_advanced(table, 4, 30, record_callback, (void *)3), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(table, 4, 10, record_callback, (void *)1), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(table, 4, 20, record_callback, (void *)2), INVALID_DEFERRED_TOKEN);
+
+    run_for(table, 40);
+
+    ASSERT_EQ(fired.size(), 3);
+    for (uintptr_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(fired[i].id, i + 1);
+        EXPECT_EQ(fired[i].now, 10 * (i + 1));
+        EXPECT_EQ(fired[i].trigger_time, 10 * (i + 1));
+    }
+
+    uint32_t next;
+    EXPECT_FALSE(deferred_exec_next_trigger_time_advanced(table, 4, &next));
+}
+
+TEST_F(DeferredExec, RejectsWhenFull) {
+    deferred_executor_t table[2] = {0};
+
+    EXPECT_NE(defer_exec_advanced(table, 2, 10, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(table, 2, 10, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, 2, 10, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, 2, 0, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+
+    run_for(table, 10);
+    EXPECT_EQ(fired.size(), 2);
+    EXPECT_NE(defer_exec_advanced(table, 2, 10, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    deferred_executor_t table[4] = {0};
+
+    deferred_token a = defer_exec_advanced(table, 4, 10, record_callback, (void *)1);
+    deferred_token b = defer_exec_advanced(table, 4, 20, record_callback, (void *)2);
+    deferred_token c = defer_exec_advanced(table, 4, 30, record_callback, (void *)3);
+
+    uint32_t next;
+    ASSERT_TRUE(deferred_exec_next_trigger_time_advanced(table, 4, &next));
+    EXPECT_EQ(next, 10);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 4, a));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 4, a));
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, 4, b, 50));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, 4, a, 50));
+
+    ASSERT_TRUE(deferred_exec_next_trigger_time_advanced(table, 4, &next));
+    EXPECT_EQ(next, 30);
+
+    run_for(table, 60);
+
+    ASSERT_EQ(fired.size(), 2);
+    EXPECT_EQ(fired[0].id, 3);
+    EXPECT_EQ(fired[0].now, 30);
+    EXPECT_EQ(fired[1].id, 2);
+    EXPECT_EQ(fired[1].now, 50);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 4, c));
+}
+
+TEST_F(DeferredExec, StaleTokenDoesNotMatchReusedSlot) {
+    deferred_executor_t table[1] = {0};
+
+    deferred_token first = defer_exec_advanced(table, 1, 10, record_callback, (void *)1);
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 1, first));
+
+    deferred_token second = defer_exec_advanced(table, 1, 10, record_callback, (void *)2);
+    EXPECT_NE(second, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 1, first));
+
+    run_for(table, 10);
+    ASSERT_EQ(fired.size(), 1);
+    EXPECT_EQ(fired[0].id, 2);
+}
+
+TEST_F(DeferredExec, RepeatKeepsCadence) {
+    deferred_executor_t table[2] = {0};
+
+    repeat_delay       = 10;
+    deferred_token tok = defer_exec_advanced(table, 2, 5, record_callback, NULL);
+
+    // Miss a few milliseconds of task execution, the next trigger should still be relative to the previous one
+    advance_time(8);
+    run_for(table, 25);
+
+    ASSERT_EQ(fired.size(), 3);
+    EXPECT_EQ(fired[0].now, 9);
+    EXPECT_EQ(fired[0].trigger_time, 5);
+    EXPECT_EQ(fired[1].trigger_time, 15);
+    EXPECT_EQ(fired[2].trigger_time, 25);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 2, tok));
+}
+
+static deferred_executor_t requeue_table[2];
+static deferred_token      requeue_token;
+
+static uint32_t requeue_callback(uint32_t trigger_time, void *cb_arg) {
+    fired.push_back({timer_read32(), trigger_time, (uintptr_t)cb_arg});
+    if (fired.size() < 3) {
+        cancel_deferred_exec_advanced(requeue_table, 2, requeue_token);
+        requeue_token = defer_exec_advanced(requeue_table, 2, 7, requeue_callback, cb_arg);
+    }
+    return 100;
+}
+
+TEST_F(DeferredExec, CallbackCanCancelAndRequeueItself) {
+    memset(requeue_table, 0, sizeof(requeue_table));
+    requeue_token = defer_exec_advanced(requeue_table, 2, 5, requeue_callback, NULL);
+
+    run_for(requeue_table, 20);
+
+    ASSERT_EQ(fired.size(), 3);
+    EXPECT_EQ(fired[0].now, 5);
+    EXPECT_EQ(fired[1].now, 12);
+    EXPECT_EQ(fired[2].now, 19);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(requeue_table, 2, requeue_token));
+}
+
+TEST_F(DeferredExec, ManyConcurrentExecutors) {
+    constexpr size_t    count = 250;
+    deferred_executor_t table[count];
+    memset(table, 0, sizeof(table));
+
+    std::vector<deferred_token> tokens(count);
+    std::vector<uint32_t>       due(count);
+    srand(1234);
+    for (uintptr_t i = 0; i < count; ++i) {
+        due[i]    = 1 + rand() % 500;
+        tokens[i] = defer_exec_advanced(table, count, due[i], record_callback, (void *)i);
+        ASSERT_NE(tokens[i], INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec_advanced(table, count, 10, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+
+    // Cancel every third executor and push every fifth one back
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 3 == 0) {
+            EXPECT_TRUE(cancel_deferred_exec_advanced(table, count, tokens[i]));
+            due[i] = 0;
+        } else if (i % 5 == 0) {
+            EXPECT_TRUE(extend_deferred_exec_advanced(table, count, tokens[i], 600));
+            due[i] = 600;
+        }
+    }
+
+    run_for(table, 600);
+
+    size_t expected = 0;
+    for (size_t i = 0; i < count; ++i) {
+        expected += due[i] ? 1 : 0;
+    }
+    ASSERT_EQ(fired.size(), expected);
+
+    uint32_t previous = 0;
+    for (auto &f : fired) {
+        EXPECT_EQ(f.now, due[f.id]);
+        EXPECT_GE(f.now, previous);
+        previous = f.now;
+    }
+}
+
+TEST_F(DeferredExec, BasicApi) {
+    deferred_token a = defer_exec(10, record_callback, (void *)1);
+    deferred_token b = defer_exec(5, record_callback, (void *)2);
+    EXPECT_NE(a, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(b, INVALID_DEFERRED_TOKEN);
+
+    uint32_t next;
+    ASSERT_TRUE(deferred_exec_next_trigger_time(&next));
+    EXPECT_EQ(next, 5);
+
+    EXPECT_TRUE(extend_deferred_exec(b, 20));
+    ASSERT_TRUE(deferred_exec_next_trigger_time(&next));
+    EXPECT_EQ(next, 10);
+
+    for (int i = 0; i < 20; ++i) {
+        advance_time(1);
+        deferred_exec_task();
+    }
+
+    ASSERT_EQ(fired.size(), 2);
+    EXPECT_EQ(fired[0].id, 1);
+    EXPECT_EQ(fired[1].id, 2);
+    EXPECT_FALSE(deferred_exec_next_trigger_time(&next));
+    EXPECT_FALSE(cancel_deferred_exec(a));
+}
@@ -0,0 +1,204 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+#include "keymap_introspection.h"
+
+static uint16_t override_limit  = 0xFFFF;
+static uint32_t override_lookups = 0;
+
+uint16_t key_override_count(void) {
+    return MIN(override_limit, key_override_count_raw());
+}
+
+const key_override_t *key_override_get(uint16_t key_override_idx) {
+    override_lookups++;
+    return key_override_get_raw(key_override_idx);
+}
+}
+
+class KeyOverride : public TestFixture {
+   protected:
+    void SetUp() override {
+        override_limit = 0xFFFF;
+        key_override_index_reset();
+    }
+};
+
+TEST_F(KeyOverride, IndexIsSizedForTheKeymap) {
+    EXPECT_EQ(key_override_index_size, key_override_count_raw());
+}
+
+TEST_F(KeyOverride, TriggerIsReplaced) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto       key_bspc  = KeymapKey(0, 1, 0, KC_BSPC);
+
+    set_keymap({key_shift, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    key_bspc.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_bspc.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, FirstListedOverrideWins) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_ctrl  = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       key_shift = KeymapKey(0, 1, 0, KC_LSFT);
+    auto       key_a     = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({key_ctrl, key_shift, key_a});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_ctrl.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    // Both shift+A and ctrl+shift+A match, the one listed first is used
+    EXPECT_REPORT(driver, (KC_LCTL, KC_B));
+    key_a.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    key_a.release();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_shift.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, NoTriggerActivatesOnModifiers) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_ctrl = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       key_alt  = KeymapKey(0, 1, 0, KC_LALT);
+
+    set_keymap({key_ctrl, key_alt});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_ctrl.press();
+    run_one_scan_loop();
+
+    // The modifiers are suppressed right away, the replacement follows after the repeat delay
+    EXPECT_EMPTY_REPORT(driver);
+    key_alt.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    idle_for(500); // KEY_OVERRIDE_REPEAT_DELAY
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    key_alt.release();
+    run_one_scan_loop();
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, OtherTriggerHeldWhenModifierPressed) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto       key_bspc  = KeymapKey(0, 1, 0, KC_BSPC);
+
+    set_keymap({key_shift, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    key_bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Pressing shift while backspace is the last key held activates the override
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    idle_for(500); // KEY_OVERRIDE_REPEAT_DELAY
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    key_shift.release();
+    key_bspc.release();
+    idle_for(500); // KEY_OVERRIDE_REPEAT_DELAY
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Cost of a key event that matches no override, with shift held so that every
+ * override needing only shift passes the cheap modifier filter. Takes the best
+ * of several batches, to keep scheduler noise out. */
+static double nanoseconds_per_event(uint16_t count, uint32_t *lookups) {
+    const int   batches = 20, events = 1000;
+    keyrecord_t record  = {};
+    double      best    = 1e9;
+
+    override_limit = count;
+    key_override_index_reset();
+    add_mods(MOD_BIT(KC_LSFT));
+    record.event.type = KEY_EVENT;
+
+    for (int batch = 0; batch < batches; batch++) {
+        override_lookups = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < events; i++) {
+            record.event.pressed = (i & 1) == 0;
+            process_key_override(KC_Z, &record);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        best = std::min(best, (double)elapsed / events);
+    }
+
+    *lookups = override_lookups;
+    del_mods(MOD_BIT(KC_LSFT));
+    return best;
+}
+
+TEST_F(KeyOverride, Benchmark) {
+    uint32_t few_lookups, many_lookups;
+
+    double few  = nanoseconds_per_event(4, &few_lookups);
+    double many = nanoseconds_per_event(key_override_count_raw(), &many_lookups);
+
+    printf("4 overrides: %.1f ns/event, %u overrides: %.1f ns/event\n", few, key_override_count_raw(), many);
+
+    // Only overrides that share the trigger, or have none, are looked at
+    EXPECT_EQ(many_lookups, few_lookups);
+}
@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    // Listed first so that it wins over the more specific override below
+    &ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_B),
+    &ko_make_basic(MOD_MASK_CS, KC_A, KC_C),
+    &ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL),
+    // No trigger key, activates on the modifiers alone
+    &ko_make_basic(MOD_MASK_CA, KC_NO, KC_ESC),
+    // Filler, so the list is as long as a layout with symbol layers and locale fixes
+    &ko_make_basic(MOD_MASK_CTRL, KC_F1, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F2, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F3, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F4, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F5, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F6, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F7, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F8, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F9, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F10, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F11, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F12, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F13, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F14, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F15, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F16, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F17, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F18, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F19, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F20, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F21, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F22, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F23, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F24, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_1, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_2, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_3, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_4, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_5, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_6, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_7, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_8, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_9, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_KP_0, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_C, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_D, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_E, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_F, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_G, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_H, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_I, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_J, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_K, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_L, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_M, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_N, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_O, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_P, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_Q, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_R, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_S, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_T, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_U, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_V, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_W, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_INS, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_HOME, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_PGUP, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_END, KC_NO),
+    &ko_make_basic(MOD_MASK_CTRL, KC_PGDN, KC_NO),
+};
+// clang-format on
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+uint16_t const yu_combo[] = {KC_Y, KC_U, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(yu_combo, KC_Z),
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_ESC, KC_CAPS),
+};
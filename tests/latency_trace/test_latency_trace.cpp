@@ -0,0 +1,241 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "latency_trace.h"
+
+void advance_time_us(uint32_t us);
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+class LatencyTrace : public TestFixture {
+   protected:
+    void SetUp() override {
+        latency_trace_clear();
+    }
+};
+
+TEST_F(LatencyTrace, PlainKeyIsReportedInTheSameScan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+    // A change at time 0 is stamped a microsecond early, as 0 means it wasn't stamped
+    idle_for(1);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_histogram_t *plain = latency_trace_get(LATENCY_PATH_PLAIN);
+    EXPECT_EQ(plain->count, 2);
+    EXPECT_EQ(plain->max, 0);
+    EXPECT_EQ(plain->buckets[0], 2);
+    EXPECT_EQ(latency_trace_get(LATENCY_PATH_MOD_TAP)->count, 0);
+}
+
+TEST_F(LatencyTrace, ModTapTapIsDelayedUntilRelease) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The tap is sent once the key is released, the release of the tap right after it
+    const latency_histogram_t *mod_tap = latency_trace_get(LATENCY_PATH_MOD_TAP);
+    EXPECT_EQ(mod_tap->count, 2);
+    EXPECT_EQ(mod_tap->min, 0);
+    EXPECT_GE(mod_tap->max, 50000);
+    EXPECT_LE(mod_tap->max, 52000);
+    EXPECT_EQ(mod_tap->buckets[16], 1);
+}
+
+TEST_F(LatencyTrace, ComboIsDelayedByTheComboTermAfterItsLastKey) {
+    TestDriver driver;
+    auto       key_y = KeymapKey(0, 0, 0, KC_Y);
+    auto       key_u = KeymapKey(0, 1, 0, KC_U);
+    set_keymap({key_y, key_u});
+    // The combo timer doesn't run when started at time 0
+    idle_for(1);
+
+    EXPECT_REPORT(driver, (KC_Z));
+    key_y.press();
+    idle_for(20);
+    key_u.press();
+    idle_for(COMBO_TERM + 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_y.release();
+    key_u.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_histogram_t *combo = latency_trace_get(LATENCY_PATH_COMBO);
+    EXPECT_EQ(combo->count, 2);
+    EXPECT_GE(combo->max, COMBO_TERM * 1000);
+    EXPECT_LE(combo->max, (COMBO_TERM + 2) * 1000);
+    EXPECT_EQ(latency_trace_get(LATENCY_PATH_PLAIN)->count, 0);
+}
+
+TEST_F(LatencyTrace, KeyOfAnUnfinishedComboIsDelayedByTheComboTerm) {
+    TestDriver driver;
+    auto       key_y = KeymapKey(0, 0, 0, KC_Y);
+    auto       key_u = KeymapKey(0, 1, 0, KC_U);
+    set_keymap({key_y, key_u});
+    idle_for(1);
+
+    EXPECT_REPORT(driver, (KC_Y));
+    key_y.press();
+    idle_for(COMBO_TERM + 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_y.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_histogram_t *plain = latency_trace_get(LATENCY_PATH_PLAIN);
+    EXPECT_EQ(plain->count, 2);
+    EXPECT_GE(plain->max, COMBO_TERM * 1000);
+    EXPECT_LE(plain->max, (COMBO_TERM + 2) * 1000);
+}
+
+TEST_F(LatencyTrace, TapDanceIsMeasuredFromItsFirstKeyEvent) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, TD(0));
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(10);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    // The dance is timed from its press, not its release, and the reset that follows isn't a key event
+    const latency_histogram_t *tap_dance = latency_trace_get(LATENCY_PATH_TAP_DANCE);
+    EXPECT_EQ(tap_dance->count, 1);
+    EXPECT_GE(tap_dance->max, TAPPING_TERM * 1000);
+    EXPECT_LE(tap_dance->max, (TAPPING_TERM + 2) * 1000);
+}
+
+TEST_F(LatencyTrace, DoubleTapDanceIsMeasuredFromItsFirstKeyEvent) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, TD(0));
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_CAPS));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key, 10);
+    idle_for(20);
+    tap_key(key, 10);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    // The second press finishes the dance, and the release after it sends its own report
+    const latency_histogram_t *tap_dance = latency_trace_get(LATENCY_PATH_TAP_DANCE);
+    EXPECT_EQ(tap_dance->count, 2);
+    EXPECT_GE(tap_dance->max, 30 * 1000);
+    EXPECT_LE(tap_dance->max, 32 * 1000);
+}
+
+TEST_F(LatencyTrace, DebounceDelayIsCounted) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    idle_for(1);
+
+    // The raw matrix changes 5ms and a bit before the debounced one does, and bounces in between
+    matrix_row_t raw[MATRIX_ROWS] = {0};
+    raw[0]                        = 1;
+    latency_trace_matrix_changed(raw);
+    advance_time_us(1200);
+    raw[0] = 0;
+    latency_trace_matrix_changed(raw);
+    advance_time_us(300);
+    raw[0] = 1;
+    latency_trace_matrix_changed(raw);
+    advance_time_us(3750);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_histogram_t *plain = latency_trace_get(LATENCY_PATH_PLAIN);
+    EXPECT_EQ(plain->count, 1);
+    EXPECT_EQ(plain->max, 5250);
+    EXPECT_EQ(plain->buckets[13], 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTrace, BounceThatSettlesIsForgotten) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    // A glitch that never makes it through debouncing mustn't be mistaken for the start of the next press
+    matrix_row_t raw[MATRIX_ROWS] = {0};
+    raw[0]                        = 1;
+    latency_trace_matrix_changed(raw);
+    raw[0] = 0;
+    latency_trace_matrix_changed(raw);
+    idle_for(100);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    advance_time_us(400);
+    key.press();
+    run_one_scan_loop();
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const latency_histogram_t *plain = latency_trace_get(LATENCY_PATH_PLAIN);
+    EXPECT_EQ(plain->count, 2);
+    EXPECT_LT(plain->max, 1000);
+}
+
+TEST_F(LatencyTrace, ClearResetsHistograms) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(latency_trace_get(LATENCY_PATH_PLAIN)->count, 2);
+
+    latency_trace_print();
+    latency_trace_clear();
+    for (uint8_t path = 0; path < LATENCY_PATH_COUNT; path++) {
+        EXPECT_EQ(latency_trace_get((latency_path_t)path)->count, 0);
+    }
+}
@@ -0,0 +1,24 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// As generated by `qmk json2c` from:
+//   {"sequence": ["KC_A", "KC_S"], "keycode": "KC_1"},
+//   {"sequence": ["KC_A", "KC_D"], "keycode": "KC_2"},
+//   {"sequence": ["KC_A", "KC_D", "KC_F"], "keycode": "KC_3"},
+//   {"sequence": ["KC_G", "KC_H"], "keycode": "LCTL(KC_H)"}
+#if defined(LEADER_ENABLE)
+#    define LEADER_TRIE_ENABLE
+// clang-format off
+const leader_trie_node_t PROGMEM leader_trie[] = {
+    [0] = {KC_NO, KC_NO, 1, 2}, // root
+    [1] = {KC_A, KC_NO, 3, 2}, // KC_A
+    [2] = {KC_G, KC_NO, 5, 1}, // KC_G
+    [3] = {KC_S, KC_1, 6, 0}, // KC_A, KC_S
+    [4] = {KC_D, KC_2, 6, 1}, // KC_A, KC_D
+    [5] = {KC_H, LCTL(KC_H), 7, 0}, // KC_G, KC_H
+    [6] = {KC_F, KC_3, 7, 0}, // KC_A, KC_D, KC_F
+};
+// clang-format on
+#endif // defined(LEADER_ENABLE)
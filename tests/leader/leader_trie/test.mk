@@ -0,0 +1,7 @@
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+LEADER_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = leader_trie.c
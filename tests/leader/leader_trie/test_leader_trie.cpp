@@ -0,0 +1,148 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+class LeaderTrie : public TestFixture {};
+
+TEST_F(LeaderTrie, unambiguous_sequence_fires_without_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_s      = KeymapKey(0, 2, 0, KC_S);
+
+    set_keymap({key_leader, key_a, key_s});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_s);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+
+    EXPECT_REPORT(driver, (KC_S));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_s);
+}
+
+TEST_F(LeaderTrie, sequence_with_longer_completion_waits_for_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_d      = KeymapKey(0, 2, 0, KC_D);
+
+    set_keymap({key_leader, key_a, key_d});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, longest_sequence_fires_without_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_d      = KeymapKey(0, 2, 0, KC_D);
+    auto key_f      = KeymapKey(0, 3, 0, KC_F);
+
+    set_keymap({key_leader, key_a, key_d, key_f});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_f);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, action_with_modifiers) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_g      = KeymapKey(0, 1, 0, KC_G);
+    auto key_h      = KeymapKey(0, 2, 0, KC_H);
+
+    set_keymap({key_leader, key_g, key_h});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_g);
+    VERIFY_AND_CLEAR(driver);
+
+    testing::InSequence s;
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_H));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_h);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTrie, unknown_sequence_does_nothing) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_g      = KeymapKey(0, 2, 0, KC_G);
+
+    set_keymap({key_leader, key_a, key_g});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_g);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, prefix_alone_does_nothing) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
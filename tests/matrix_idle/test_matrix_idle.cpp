@@ -0,0 +1,217 @@
+/* Copyright 2026 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+static bool     idle_allowed = true;
+static uint32_t sleeps       = 0;
+static uint32_t last_sleep   = 0;
+
+extern "C" bool matrix_idle_ready_user(void) {
+    return idle_allowed;
+}
+
+extern "C" void matrix_idle_sleep(uint32_t ms) {
+    sleeps++;
+    last_sleep = ms;
+}
+
+static uint32_t deferred_calls = 0;
+
+static uint32_t count_deferred_call(uint32_t trigger_time, void *cb_arg) {
+    deferred_calls++;
+    return 0;
+}
+
+class MatrixIdle : public TestFixture {
+   protected:
+    void SetUp() override {
+        idle_allowed   = true;
+        sleeps         = 0;
+        last_sleep     = 0;
+        deferred_calls = 0;
+    }
+
+    /* Taps a key so every test starts from fresh matrix activity. */
+    void wake_up(TestDriver& driver, KeymapKey& key) {
+        key.press();
+        EXPECT_REPORT(driver, (key.report_code));
+        run_one_scan_loop();
+        key.release();
+        EXPECT_EMPTY_REPORT(driver);
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+    }
+};
+
+TEST_F(MatrixIdle, IdlesAfterTimeout) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    wake_up(driver, key);
+    EXPECT_FALSE(matrix_is_idle());
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_IDLE_TIMEOUT - 10);
+    EXPECT_FALSE(matrix_is_idle());
+
+    idle_for(20);
+    EXPECT_TRUE(matrix_is_idle());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixIdle, PressWhileIdleIsReportedOnNextScan) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+    wake_up(driver, key_a);
+    idle_for(MATRIX_IDLE_TIMEOUT * 2);
+    ASSERT_TRUE(matrix_is_idle());
+
+    key_b.press();
+    EXPECT_REPORT(driver, (KC_B));
+    run_one_scan_loop();
+    EXPECT_FALSE(matrix_is_idle());
+    VERIFY_AND_CLEAR(driver);
+
+    key_b.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixIdle, HeldKeyKeepsScanning) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+    wake_up(driver, key_a);
+
+    key_a.press();
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    idle_for(MATRIX_IDLE_TIMEOUT * 2);
+    EXPECT_FALSE(matrix_is_idle());
+
+    /* Presses and releases made while another key is held are not lost */
+    key_b.press();
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    run_one_scan_loop();
+    key_a.release();
+    EXPECT_REPORT(driver, (KC_B));
+    run_one_scan_loop();
+    key_b.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixIdle, ReadyHookCanVeto) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    wake_up(driver, key);
+
+    idle_allowed = false;
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_IDLE_TIMEOUT * 2);
+    EXPECT_FALSE(matrix_is_idle());
+
+    idle_allowed = true;
+    run_one_scan_loop();
+    EXPECT_TRUE(matrix_is_idle());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixIdle, SleepsOnlyWhileIdle) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    wake_up(driver, key);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_IDLE_TIMEOUT - 10);
+    EXPECT_EQ(sleeps, 0);
+
+    idle_for(20);
+    ASSERT_TRUE(matrix_is_idle());
+    sleeps = 0;
+    run_one_scan_loop();
+    EXPECT_EQ(sleeps, 1);
+    EXPECT_EQ(last_sleep, MATRIX_IDLE_SLEEP_MAX);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The wakeup is handled in the same loop, without sleeping */
+    sleeps = 0;
+    key.press();
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    EXPECT_EQ(sleeps, 0);
+    EXPECT_FALSE(matrix_is_idle());
+    VERIFY_AND_CLEAR(driver);
+
+    key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixIdle, SleepEndsAtTheNextDeferredExecution) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    wake_up(driver, key);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_IDLE_TIMEOUT * 2);
+    ASSERT_TRUE(matrix_is_idle());
+
+    ASSERT_NE(defer_exec(3, count_deferred_call, NULL), INVALID_DEFERRED_TOKEN);
+    run_one_scan_loop();
+    EXPECT_EQ(last_sleep, 3);
+
+    /* Once it is due the loop keeps running until it has been executed */
+    idle_for(2);
+    sleeps = 0;
+    run_one_scan_loop();
+    EXPECT_EQ(sleeps, 0);
+
+    /* The main loop runs deferred executors after keyboard_task(), the test fixture doesn't */
+    deferred_exec_task();
+    EXPECT_EQ(deferred_calls, 1);
+
+    run_one_scan_loop();
+    EXPECT_EQ(last_sleep, MATRIX_IDLE_SLEEP_MAX);
+    EXPECT_TRUE(matrix_is_idle());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION true
+
+// Small buffers, so that each transfer only covers a couple of rows of the animation
+#define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 256
+
+// The animated display, a reference display and a surface for drawing other things in between
+#define SURFACE_NUM_DEVICES 3
@@ -0,0 +1,9 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+SRC += \
+    ../painter_test_codec.cpp \
+    ../painter_test_image.cpp
@@ -0,0 +1,241 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../painter_test_image.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+void qp_internal_animation_tick(void);
+}
+
+static const uint16_t panel_width  = 80;
+static const uint16_t panel_height = 80;
+static const uint16_t anim_x       = 8;
+static const uint16_t anim_y       = 8;
+
+typedef std::vector<uint16_t> framebuffer_t;
+
+static uint16_t         display_framebuffer[panel_width * panel_height];
+static uint16_t         reference_framebuffer[panel_width * panel_height];
+static uint16_t         other_framebuffer[panel_width * panel_height];
+static painter_device_t display;
+static painter_device_t reference;
+static painter_device_t other_surface;
+
+// Simulated slow display: every transfer takes a millisecond, so that animations run out of their time budget
+static painter_driver_vtable_t        slow_vtable;
+static const painter_driver_vtable_t *display_vtable;
+static uint32_t                       transfers;
+static std::vector<test_image_rect_t> viewports;
+
+static bool slow_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    transfers++;
+    advance_time(1);
+    return display_vtable->pixdata(device, pixel_data, native_pixel_count);
+}
+
+static bool slow_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    viewports.push_back({left, top, right, bottom});
+    return display_vtable->viewport(device, left, top, right, bottom);
+}
+
+class AnimationSlices : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same ones
+    static void SetUpTestSuite() {
+        display       = qp_make_rgb565_surface(panel_width, panel_height, display_framebuffer);
+        reference     = qp_make_rgb565_surface(panel_width, panel_height, reference_framebuffer);
+        other_surface = qp_make_rgb565_surface(panel_width, panel_height, other_framebuffer);
+        for (painter_device_t device : {display, reference, other_surface}) {
+            qp_init(device, QP_ROTATION_0);
+        }
+
+        painter_driver_t *driver = (painter_driver_t *)display;
+        display_vtable           = driver->driver_vtable;
+        slow_vtable              = *display_vtable;
+        slow_vtable.pixdata      = slow_pixdata;
+        slow_vtable.viewport     = slow_viewport;
+        driver->driver_vtable    = &slow_vtable;
+    }
+
+    void SetUp() override {
+        memset(display_framebuffer, 0, sizeof(display_framebuffer));
+        memset(reference_framebuffer, 0, sizeof(reference_framebuffer));
+        viewports.clear();
+    }
+
+    void TearDown() override {
+        for (painter_image_handle_t image : images) {
+            qp_close_image(image);
+        }
+        images.clear();
+        assets.clear();
+    }
+
+    painter_image_handle_t load_image(std::vector<uint8_t> data) {
+        assets.push_back(std::move(data));
+        painter_image_handle_t image = qp_load_image_mem(assets.back().data());
+        EXPECT_NE(image, nullptr);
+        images.push_back(image);
+        return image;
+    }
+
+    // Plays every frame on the reference display, which never falls behind, and returns what each one looks like
+    std::vector<framebuffer_t> reference_frames(painter_image_handle_t image, uint16_t delay) {
+        std::vector<framebuffer_t> frames;
+        deferred_token             token = qp_animate(reference, anim_x, anim_y, image);
+        EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+        for (uint16_t frame = 0; frame < image->frame_count; ++frame) {
+            if (frame > 0) {
+                advance_time(delay);
+                qp_internal_animation_tick();
+            }
+            frames.push_back(framebuffer_t(reference_framebuffer, reference_framebuffer + panel_width * panel_height));
+        }
+        qp_stop_animation(token);
+        return frames;
+    }
+
+    bool display_shows(const framebuffer_t &frame) {
+        return memcmp(display_framebuffer, frame.data(), sizeof(display_framebuffer)) == 0;
+    }
+
+    // Runs the main loop a millisecond at a time until the display shows the expected frame, returning how many passes
+    // it took -- or 0 if it never got there. Also tracks the most transfers done by a single pass.
+    uint32_t run_until_shown(const framebuffer_t &frame, uint32_t *max_transfers = nullptr, std::function<void(void)> between = nullptr) {
+        for (uint32_t passes = 1; passes <= 1000; ++passes) {
+            advance_time(1);
+            transfers = 0;
+            qp_internal_animation_tick();
+            if (max_transfers) {
+                *max_transfers = std::max(*max_transfers, transfers);
+            }
+            if (display_shows(frame)) {
+                return passes;
+            }
+            if (between) {
+                between();
+            }
+        }
+        return 0;
+    }
+
+    void advance_to(uint32_t time) {
+        advance_time(time - timer_read32());
+    }
+
+    bool viewport_seen(test_image_rect_t rect) {
+        return std::any_of(viewports.begin(), viewports.end(), [&](const test_image_rect_t &v) { return v.left == anim_x + rect.left && v.top == anim_y + rect.top && v.right == anim_x + rect.right && v.bottom == anim_y + rect.bottom; });
+    }
+
+    std::vector<std::vector<uint8_t>>   assets;
+    std::vector<painter_image_handle_t> images;
+};
+
+TEST_F(AnimationSlices, FramesAreSpreadAcrossPasses) {
+    const uint16_t             delay     = 200;
+    painter_image_handle_t     animation = load_image(make_test_image(64, 64, 3, 4, true, IMAGE_COMPRESSED_RLE, delay));
+    painter_image_handle_t     grayscale = load_image(make_test_image(16, 16, 1, 2));
+    std::vector<framebuffer_t> frames    = reference_frames(animation, delay);
+
+    uint32_t       start = timer_read32();
+    deferred_token token = qp_animate(display, anim_x, anim_y, animation);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_TRUE(display_shows(frames[0]));
+
+    // Drawing other things in between moves the image's stream and replaces the palette, neither of which may leak into
+    // the animation
+    auto draw_other = [&]() {
+        EXPECT_TRUE(qp_drawimage(other_surface, 0, 0, animation));
+        EXPECT_TRUE(qp_drawimage(other_surface, 0, 0, grayscale));
+    };
+
+    for (uint16_t frame : {1, 2, 0}) {
+        advance_to(start + (frame == 0 ? 3 : frame) * delay - 1);
+        uint32_t max_transfers = 0;
+        uint32_t passes        = run_until_shown(frames[frame], &max_transfers, draw_other);
+
+        // 64 rows of 64 pixels need 32 transfers of 128 pixels, two transfers take up the time budget of each pass
+        EXPECT_EQ(passes, 16) << "frame " << frame;
+        EXPECT_LE(max_transfers, 2) << "frame " << frame;
+    }
+
+    qp_stop_animation(token);
+}
+
+TEST_F(AnimationSlices, DeltaFramesResumeOnByteBoundaries) {
+    // 1bpp rows of 33 pixels don't end on byte boundaries, so passes may only stop every 8 rows
+    const uint16_t                 delay  = 100;
+    std::vector<test_image_rect_t> deltas = {{0, 0, 0, 0}, {8, 8, 40, 40}, {16, 0, 48, 31}, {0, 32, 32, 63}};
+    for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+        painter_image_handle_t     animation = load_image(make_test_delta_image(64, 64, deltas, 1, compression, delay));
+        std::vector<framebuffer_t> frames    = reference_frames(animation, delay);
+        memset(display_framebuffer, 0, sizeof(display_framebuffer));
+
+        uint32_t       start = timer_read32();
+        deferred_token token = qp_animate(display, anim_x, anim_y, animation);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        EXPECT_TRUE(display_shows(frames[0]));
+
+        for (uint16_t frame = 1; frame < deltas.size(); ++frame) {
+            advance_to(start + frame * delay - 1);
+            viewports.clear();
+            EXPECT_GT(run_until_shown(frames[frame]), 1) << "frame " << frame;
+            EXPECT_TRUE(viewport_seen(deltas[frame])) << "frame " << frame;
+        }
+
+        qp_stop_animation(token);
+    }
+}
+
+TEST_F(AnimationSlices, LZFramesAreDrawnInOnePass) {
+    // LZ frames share the match window with everything else being decoded, so they can't be interrupted
+    const uint16_t             delay     = 100;
+    painter_image_handle_t     animation = load_image(make_test_image(64, 64, 2, 4, false, IMAGE_COMPRESSED_LZ, delay));
+    std::vector<framebuffer_t> frames    = reference_frames(animation, delay);
+
+    uint32_t       start = timer_read32();
+    deferred_token token = qp_animate(display, anim_x, anim_y, animation);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+
+    advance_to(start + delay - 1);
+    EXPECT_EQ(run_until_shown(frames[1]), 1);
+
+    qp_stop_animation(token);
+}
+
+TEST_F(AnimationSlices, OverdueFramesAreSkippedWhenCovered) {
+    const uint16_t delay = 50;
+    // Frame 2 redraws everything frame 1 changed, but frame 4 doesn't cover frame 3
+    std::vector<test_image_rect_t> deltas    = {{0, 0, 0, 0}, {10, 10, 20, 20}, {0, 0, 40, 40}, {30, 30, 60, 60}, {0, 0, 20, 20}};
+    painter_image_handle_t         animation = load_image(make_test_delta_image(64, 64, deltas, 2, IMAGE_COMPRESSED_RLE, delay));
+    std::vector<framebuffer_t>     frames    = reference_frames(animation, delay);
+
+    uint32_t       start = timer_read32();
+    deferred_token token = qp_animate(display, anim_x, anim_y, animation);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+
+    // Frame 2 is already due, so frame 1 is skipped altogether
+    advance_to(start + 2 * delay + 10);
+    viewports.clear();
+    EXPECT_GT(run_until_shown(frames[2]), 0);
+    EXPECT_FALSE(viewport_seen(deltas[1]));
+
+    // Frame 4 is already due as well, but skipping frame 3 would leave parts of it out
+    advance_to(start + 4 * delay + 10);
+    viewports.clear();
+    EXPECT_GT(run_until_shown(frames[4]), 0);
+    EXPECT_TRUE(viewport_seen(deltas[3]));
+
+    qp_stop_animation(token);
+}
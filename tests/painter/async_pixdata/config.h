@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_ASYNC_PIXDATA true
+
+// One display with simulated asynchronous transfers, one without, and a surface to transfer to both
+#define SURFACE_NUM_DEVICES 3
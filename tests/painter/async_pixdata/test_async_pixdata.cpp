@@ -0,0 +1,181 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../painter_test_font.hpp"
+#include "../painter_test_image.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_surface.h"
+}
+
+static const uint16_t panel_width  = 160;
+static const uint16_t panel_height = 120;
+
+static uint16_t         async_framebuffer[panel_width * panel_height];
+static uint16_t         sync_framebuffer[panel_width * panel_height];
+static uint16_t         source_framebuffer[panel_width * panel_height];
+static painter_device_t async_display;
+static painter_device_t sync_display;
+static painter_device_t source_surface;
+
+// Simulated DMA: pixel data that may be sent asynchronously is only read once the next transfer, command or the end
+// of the transaction comes along, so anything overwriting it in the meantime shows up in the output.
+static painter_driver_vtable_t        async_vtable;
+static painter_comms_vtable_t         async_comms_vtable;
+static const painter_driver_vtable_t *display_vtable;
+static const painter_comms_vtable_t  *display_comms_vtable;
+static const void                    *pending_data;
+static uint32_t                       pending_pixels;
+static std::set<const void *>         async_buffers;
+static uint32_t                       async_transfers;
+
+static void complete_pending(painter_device_t device) {
+    if (pending_data) {
+        display_vtable->pixdata(device, pending_data, pending_pixels);
+        pending_data = NULL;
+    }
+}
+
+static bool async_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    complete_pending(device);
+    if (!qp_internal_pixdata_can_send_async(pixel_data)) {
+        return display_vtable->pixdata(device, pixel_data, native_pixel_count);
+    }
+    pending_data   = pixel_data;
+    pending_pixels = native_pixel_count;
+    async_buffers.insert(pixel_data);
+    async_transfers++;
+    return true;
+}
+
+static bool async_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    complete_pending(device);
+    return display_vtable->viewport(device, left, top, right, bottom);
+}
+
+static bool async_comms_stop(painter_device_t device) {
+    complete_pending(device);
+    return display_comms_vtable->comms_stop(device);
+}
+
+class AsyncPixdata : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same ones
+    static void SetUpTestSuite() {
+        async_display  = qp_make_rgb565_surface(panel_width, panel_height, async_framebuffer);
+        sync_display   = qp_make_rgb565_surface(panel_width, panel_height, sync_framebuffer);
+        source_surface = qp_make_rgb565_surface(panel_width, panel_height, source_framebuffer);
+        for (painter_device_t device : {async_display, sync_display, source_surface}) {
+            qp_init(device, QP_ROTATION_0);
+        }
+
+        painter_driver_t *driver        = (painter_driver_t *)async_display;
+        display_vtable                  = driver->driver_vtable;
+        display_comms_vtable            = driver->comms_vtable;
+        async_vtable                    = *display_vtable;
+        async_vtable.pixdata            = async_pixdata;
+        async_vtable.viewport           = async_viewport;
+        async_comms_vtable              = *display_comms_vtable;
+        async_comms_vtable.comms_stop   = async_comms_stop;
+        driver->driver_vtable           = &async_vtable;
+        driver->comms_vtable            = &async_comms_vtable;
+    }
+
+    void SetUp() override {
+        memset(async_framebuffer, 0, sizeof(async_framebuffer));
+        memset(sync_framebuffer, 0, sizeof(sync_framebuffer));
+        async_buffers.clear();
+        async_transfers = 0;
+    }
+
+    void expect_same_output() {
+        EXPECT_EQ(pending_data, nullptr);
+        EXPECT_EQ(0, memcmp(async_framebuffer, sync_framebuffer, sizeof(async_framebuffer)));
+    }
+};
+
+TEST_F(AsyncPixdata, ImagesAlternateBetweenBuffers) {
+    for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+        std::vector<uint8_t>   data  = make_test_image(96, 96, 1, 4, true, compression);
+        painter_image_handle_t image = qp_load_image_mem(data.data());
+        ASSERT_NE(image, nullptr);
+        for (painter_device_t device : {async_display, sync_display}) {
+            EXPECT_TRUE(qp_drawimage(device, 10, 10, image));
+        }
+        qp_close_image(image);
+    }
+
+    // 96x96 pixels need 18 full buffers of 512 pixels each
+    EXPECT_EQ(async_transfers, 36);
+    EXPECT_EQ(async_buffers.size(), 2);
+    expect_same_output();
+}
+
+TEST_F(AsyncPixdata, PrimitivesBetweenImages) {
+    std::vector<uint8_t>   data  = make_test_image(64, 40, 1, 2);
+    painter_image_handle_t image = qp_load_image_mem(data.data());
+    ASSERT_NE(image, nullptr);
+    std::vector<uint8_t>  font_data = make_test_font({0x00E9}, 12, 1);
+    painter_font_handle_t font      = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr);
+
+    for (painter_device_t device : {async_display, sync_display}) {
+        qp_drawimage_recolor(device, 0, 0, image, 0, 255, 255, 170, 255, 64);
+        qp_rect(device, 20, 20, 100, 60, 85, 255, 255, true);
+        qp_drawtext(device, 4, 70, font, "Async pixdata");
+        qp_circle(device, 120, 80, 30, 43, 255, 255, false);
+        qp_drawimage(device, 90, 10, image);
+        qp_line(device, 0, 119, 159, 0, 213, 255, 255);
+    }
+    qp_close_font(font);
+    qp_close_image(image);
+
+    EXPECT_GT(async_transfers, 0);
+    expect_same_output();
+}
+
+TEST_F(AsyncPixdata, SurfaceTransfer) {
+    for (uint16_t y = 0; y < panel_height; ++y) {
+        for (uint16_t x = 0; x < panel_width; ++x) {
+            source_framebuffer[y * panel_width + x] = x * 131 + y * 7;
+        }
+    }
+    for (painter_device_t device : {async_display, sync_display}) {
+        // Transferring resets the dirty region, and only pixels that actually change set it again
+        qp_setpixel(source_surface, 0, 0, 0, 0, 0);
+        qp_setpixel(source_surface, 0, 0, 0, 0, 255);
+        EXPECT_TRUE(qp_surface_draw(source_surface, device, 0, 0, true));
+    }
+
+    // 160x120 pixels fill 37 buffers and a bit
+    EXPECT_EQ(async_transfers, 38);
+    EXPECT_EQ(async_buffers.size(), 2);
+    expect_same_output();
+    EXPECT_EQ(0, memcmp(async_framebuffer, source_framebuffer, sizeof(source_framebuffer)));
+}
+
+TEST_F(AsyncPixdata, StopAsyncFallsBackToStop) {
+    // The same sequence LVGL uses to flush an area, on comms that can't end the transaction after the transfer
+    std::vector<uint16_t> area(32 * 16);
+    for (size_t i = 0; i < area.size(); ++i) {
+        area[i] = i * 37;
+    }
+    for (painter_device_t device : {async_display, sync_display}) {
+        painter_driver_t *driver = (painter_driver_t *)device;
+        ASSERT_TRUE(qp_comms_start(device));
+        ASSERT_TRUE(driver->driver_vtable->viewport(device, 40, 50, 71, 65));
+        ASSERT_TRUE(qp_internal_pixdata_async(device, area.data(), area.size()));
+        qp_comms_stop_async(device);
+    }
+
+    EXPECT_EQ(async_transfers, 1);
+    expect_same_output();
+}
@@ -0,0 +1,8 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION true
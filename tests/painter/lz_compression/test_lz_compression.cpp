@@ -0,0 +1,159 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../painter_test_codec.hpp"
+#include "../painter_test_font.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_draw.h"
+#include "qp_surface.h"
+}
+
+static const uint8_t  line_height = 10;
+static const uint16_t panel_width = 480;
+
+static uint16_t         framebuffer[panel_width * line_height];
+static painter_device_t surface;
+
+// Pulls `length` bytes through the decoder for the given compression, failed reads are returned as -1
+static std::vector<int16_t> decode(const std::vector<uint8_t> &compressed, painter_compression_t compression, size_t length) {
+    qp_memory_stream_t             stream = qp_make_memory_stream((void *)compressed.data(), compressed.size());
+    qp_internal_byte_input_state_t input_state;
+    memset(&input_state, 0, sizeof(input_state));
+    input_state.src_stream                         = (qp_stream_t *)&stream;
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, compression);
+    EXPECT_NE(input_callback, nullptr);
+
+    std::vector<int16_t> out;
+    for (size_t i = 0; i < length; ++i) {
+        out.push_back(input_callback(&input_state));
+    }
+    return out;
+}
+
+static std::vector<int16_t> widen(const std::vector<uint8_t> &data) {
+    return std::vector<int16_t>(data.begin(), data.end());
+}
+
+// Rows of 4bpp pixels made of a few repeated sprites with some noise, roughly what a converted animation looks like
+static std::vector<uint8_t> image_like_data(size_t length) {
+    std::vector<uint8_t> data;
+    uint32_t             seed = 12345;
+    for (size_t i = 0; i < length; ++i) {
+        seed = seed * 1103515245 + 12345;
+        uint8_t sprite = (i / 64) % 3;
+        uint8_t pixel  = (i % 16 < 4 + sprite * 3) ? 0x11 * (sprite + 1) : 0x00;
+        data.push_back((seed >> 16) % 23 == 0 ? (seed >> 8) & 0xFF : pixel);
+    }
+    return data;
+}
+
+class LzCompression : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same one
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(panel_width, line_height, framebuffer);
+        qp_init(surface, QP_ROTATION_0);
+    }
+
+    void SetUp() override {
+        memset(framebuffer, 0x55, sizeof(framebuffer));
+    }
+};
+
+TEST_F(LzCompression, DecodesLiteralsAndMatches) {
+    // "abc", then 6 bytes from 3 back, then 3 bytes from 1 back
+    std::vector<uint8_t> compressed = {0x02, 'a', 'b', 'c', 0x83, 0x02, 0x80, 0x00};
+    std::string          expected   = "abcabcabcccc";
+    EXPECT_EQ(decode(compressed, IMAGE_COMPRESSED_LZ, expected.size()), widen(std::vector<uint8_t>(expected.begin(), expected.end())));
+}
+
+TEST_F(LzCompression, MatchesPythonEncoder) {
+    // Same vector as lib/python/qmk/tests/test_qmk_painter.py
+    std::string          text     = std::string("abcabcabcccc") + "Quantum Painter, Quantum Painter!" + std::string(140, '\x07');
+    std::vector<uint8_t> input(text.begin(), text.end());
+    std::vector<uint8_t> expected = {0x02, 0x61, 0x62, 0x63, 0x83, 0x02, 0x80, 0x00, 0x10, 0x51, 0x75, 0x61, 0x6E, 0x74, 0x75, 0x6D, 0x20, 0x50, 0x61, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x8C, 0x10, 0x01, 0x21, 0x07, 0xFF, 0x00, 0x86, 0x00};
+    EXPECT_EQ(lz_encode(input), expected);
+    EXPECT_EQ(decode(expected, IMAGE_COMPRESSED_LZ, input.size()), widen(input));
+}
+
+TEST_F(LzCompression, RoundTrip) {
+    std::vector<std::vector<uint8_t>> inputs;
+    inputs.push_back({42});
+    inputs.push_back(std::vector<uint8_t>(1000, 7));
+    std::vector<uint8_t> counting, noise;
+    uint32_t             seed = 1;
+    for (size_t i = 0; i < 3000; ++i) {
+        counting.push_back(i % 200); // matches at the far end of the window
+        seed = seed * 1103515245 + 12345;
+        noise.push_back(seed >> 16); // long literal runs
+    }
+    inputs.push_back(counting);
+    inputs.push_back(noise);
+    inputs.push_back(image_like_data(20000));
+
+    for (const std::vector<uint8_t> &input : inputs) {
+        std::vector<uint8_t> compressed = lz_encode(input);
+        EXPECT_EQ(decode(compressed, IMAGE_COMPRESSED_LZ, input.size()), widen(input));
+    }
+}
+
+TEST_F(LzCompression, RepetitiveDataCompresses) {
+    std::vector<uint8_t> input = image_like_data(20000);
+    std::vector<uint8_t> lz    = lz_encode(input);
+    EXPECT_LT(lz.size(), input.size() / 2);
+}
+
+TEST_F(LzCompression, TruncatedStreamFails) {
+    std::vector<uint8_t> compressed = lz_encode(std::vector<uint8_t>(100, 7));
+    compressed.pop_back();
+    std::vector<int16_t> decoded = decode(compressed, IMAGE_COMPRESSED_LZ, 100);
+    EXPECT_EQ(decoded[0], 7);
+    EXPECT_LT(decoded[99], 0);
+}
+
+TEST_F(LzCompression, FontDrawsLikeUncompressed) {
+    std::vector<uint32_t> unicode_glyphs = {0x00E9, 0x03A9, 0x4E2D, 0x6587};
+    std::string           str            = "Hello, QMK " + utf8(0x00E9) + utf8(0x4E2D) + " world!";
+    for (uint8_t bpp : {1, 2, 4}) {
+        std::vector<std::vector<uint16_t>> drawn;
+        for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_LZ}) {
+            memset(framebuffer, 0x55, sizeof(framebuffer));
+            std::vector<uint8_t>  font_data = make_test_font(unicode_glyphs, line_height, bpp, compression);
+            painter_font_handle_t font      = qp_load_font_mem(font_data.data());
+            ASSERT_NE(font, nullptr);
+            EXPECT_GT(qp_drawtext_recolor(surface, 0, 0, font, str.c_str(), 0, 255, 255, 85, 255, 128), 0);
+            qp_close_font(font);
+            drawn.push_back(std::vector<uint16_t>(framebuffer, framebuffer + panel_width * line_height));
+        }
+        EXPECT_EQ(drawn[0], drawn[1]) << "bpp " << (int)bpp;
+    }
+}
+
+TEST_F(LzCompression, DecodeBenchmark) {
+    std::vector<uint8_t> input = image_like_data(1 << 20);
+    for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_LZ}) {
+        std::vector<uint8_t> compressed = compression == IMAGE_COMPRESSED_LZ ? lz_encode(input) : input;
+
+        qp_memory_stream_t             stream = qp_make_memory_stream(compressed.data(), compressed.size());
+        qp_internal_byte_input_state_t input_state;
+        memset(&input_state, 0, sizeof(input_state));
+        input_state.src_stream                         = (qp_stream_t *)&stream;
+        qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, compression);
+
+        uint32_t checksum = 0;
+        auto     start    = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < input.size(); ++i) {
+            checksum += input_callback(&input_state);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        printf("%s: %d bytes decoded from %d in %ldus (%ld MB/s), checksum %u\n", compression == IMAGE_COMPRESSED_LZ ? "LZ" : "uncompressed", (int)input.size(), (int)compressed.size(), (long)elapsed.count(), (long)(input.size() / std::max<long>(1, elapsed.count())), (unsigned)checksum);
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "painter_test_codec.hpp"
+
+#include <algorithm>
+
+std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    for (size_t i = 0; i < data.size(); i += 128) {
+        size_t count = std::min<size_t>(128, data.size() - i);
+        out.push_back(127 + count);
+        out.insert(out.end(), data.begin() + i, data.begin() + i + count);
+    }
+    return out;
+}
+
+static void flush_literals(std::vector<uint8_t> &out, std::vector<uint8_t> &literals) {
+    if (!literals.empty()) {
+        out.push_back(literals.size() - 1);
+        out.insert(out.end(), literals.begin(), literals.end());
+        literals.clear();
+    }
+}
+
+std::vector<uint8_t> lz_encode(const std::vector<uint8_t> &data) {
+    const size_t window_size = 256, min_match = 3, max_match = 130, max_literals = 128;
+
+    std::vector<uint8_t> out, literals;
+
+    size_t n = 0;
+    while (n < data.size()) {
+        // Find the longest match within the window, preferring the closest one
+        size_t match_length = 0, match_distance = 0;
+        for (size_t distance = 1; distance <= window_size && distance <= n; ++distance) {
+            size_t length = 0;
+            while (length < max_match && n + length < data.size() && data[n + length - distance] == data[n + length]) {
+                ++length;
+            }
+            if (length > match_length) {
+                match_length   = length;
+                match_distance = distance;
+            }
+        }
+
+        if (match_length >= min_match) {
+            flush_literals(out, literals);
+            out.push_back(0x80 + match_length - min_match);
+            out.push_back(match_distance - 1);
+            n += match_length;
+        } else {
+            literals.push_back(data[n++]);
+            if (literals.size() == max_literals) {
+                flush_literals(out, literals);
+            }
+        }
+    }
+
+    flush_literals(out, literals);
+    return out;
+}
+
+std::vector<uint8_t> pack_pixels(const std::vector<uint8_t> &pixels, uint8_t bpp) {
+    std::vector<uint8_t> out;
+    uint8_t              pixels_per_byte = 8 / bpp;
+    for (size_t i = 0; i < pixels.size(); i += pixels_per_byte) {
+        uint8_t byte = 0;
+        for (size_t j = i; j < i + pixels_per_byte && j < pixels.size(); ++j) {
+            byte |= pixels[j] << ((j - i) * bpp);
+        }
+        out.push_back(byte);
+    }
+    return out;
+}
+
+void append_le(std::vector<uint8_t> &out, uint32_t value, uint8_t bytes) {
+    for (uint8_t i = 0; i < bytes; ++i) {
+        out.push_back((value >> (i * 8)) & 0xFF);
+    }
+}
+
+void append_block_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    out.push_back(type_id);
+    out.push_back(~type_id);
+    append_le(out, length, 3);
+}
@@ -0,0 +1,22 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Encodes everything as non-repeating runs, which is valid RLE even if it doesn't save anything
+std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &data);
+
+// Greedy LZ encoder, producing the same output as compress_bytes_qmk_lz() in lib/python/qmk/painter.py
+std::vector<uint8_t> lz_encode(const std::vector<uint8_t> &data);
+
+// Packs pixel values least significant bits first, as stored in QGF/QFF pixel data
+std::vector<uint8_t> pack_pixels(const std::vector<uint8_t> &pixels, uint8_t bpp);
+
+// Appends a little-endian value of the given number of bytes
+void append_le(std::vector<uint8_t> &out, uint32_t value, uint8_t bytes);
+
+// Appends a QGF/QFF block header
+void append_block_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length);
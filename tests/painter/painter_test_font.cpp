@@ -0,0 +1,90 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "painter_test_font.hpp"
+#include "painter_test_codec.hpp"
+
+uint8_t test_glyph_width(uint32_t code_point) {
+    return 3 + code_point % 6;
+}
+
+uint8_t test_glyph_pixel(uint32_t code_point, uint8_t x, uint8_t y, uint8_t bpp) {
+    uint32_t hash = (code_point * 2654435761u) ^ (x * 40503u) ^ (y * 9973u);
+    return (hash >> 7) & ((1 << bpp) - 1);
+}
+
+std::vector<uint8_t> make_test_font(const std::vector<uint32_t> &unicode_glyphs, uint8_t line_height, uint8_t bpp, painter_compression_t compression) {
+    std::vector<uint8_t>  ascii_table, unicode_table, data;
+    std::vector<uint32_t> code_points;
+    for (uint32_t c = 0x20; c < 0x7F; ++c) {
+        code_points.push_back(c);
+    }
+    code_points.insert(code_points.end(), unicode_glyphs.begin(), unicode_glyphs.end());
+
+    for (uint32_t code_point : code_points) {
+        uint8_t  width = test_glyph_width(code_point);
+        uint32_t value = (data.size() << 6) | width;
+        if (code_point < 0x7F) {
+            append_le(ascii_table, value, 3);
+        } else {
+            append_le(unicode_table, code_point, 3);
+            append_le(unicode_table, value, 3);
+        }
+
+        // Each glyph starts on a new byte
+        std::vector<uint8_t> pixels;
+        for (uint16_t i = 0; i < width * line_height; ++i) {
+            pixels.push_back(test_glyph_pixel(code_point, i % width, i / width, bpp));
+        }
+        std::vector<uint8_t> glyph = pack_pixels(pixels, bpp);
+        if (compression == IMAGE_COMPRESSED_RLE) {
+            glyph = rle_encode(glyph);
+        } else if (compression == IMAGE_COMPRESSED_LZ) {
+            glyph = lz_encode(glyph);
+        }
+        data.insert(data.end(), glyph.begin(), glyph.end());
+    }
+
+    std::vector<uint8_t> body;
+    append_block_header(body, 0x01, ascii_table.size());
+    body.insert(body.end(), ascii_table.begin(), ascii_table.end());
+    if (!unicode_glyphs.empty()) {
+        append_block_header(body, 0x02, unicode_table.size());
+        body.insert(body.end(), unicode_table.begin(), unicode_table.end());
+    }
+    append_block_header(body, 0x04, data.size());
+    body.insert(body.end(), data.begin(), data.end());
+
+    const uint8_t        format     = bpp == 1 ? 0x00 : bpp == 2 ? 0x01 : bpp == 4 ? 0x02 : 0x03;
+    uint32_t             total_size = 25 + body.size();
+    std::vector<uint8_t> font;
+    append_block_header(font, 0x00, 20);
+    append_le(font, 0x464651, 3);              // magic
+    font.push_back(0x01);                      // version
+    append_le(font, total_size, 4);            // total_file_size
+    append_le(font, ~total_size, 4);           // neg_total_file_size
+    font.push_back(line_height);               // line_height
+    font.push_back(1);                         // has_ascii_table
+    append_le(font, unicode_glyphs.size(), 2); // num_unicode_glyphs
+    font.push_back(format);                    // format: GRAYSCALE_*BPP
+    font.push_back(0x00);                      // flags
+    font.push_back(compression);               // compression_scheme
+    font.push_back(0xFF);                      // transparency_index
+    font.insert(font.end(), body.begin(), body.end());
+    return font;
+}
+
+std::string utf8(uint32_t code_point) {
+    std::string out;
+    if (code_point < 0x80) {
+        out += (char)code_point;
+    } else if (code_point < 0x800) {
+        out += (char)(0xC0 | (code_point >> 6));
+        out += (char)(0x80 | (code_point & 0x3F));
+    } else {
+        out += (char)(0xE0 | (code_point >> 12));
+        out += (char)(0x80 | ((code_point >> 6) & 0x3F));
+        out += (char)(0x80 | (code_point & 0x3F));
+    }
+    return out;
+}
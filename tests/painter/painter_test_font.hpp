@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "qp_internal.h"
+}
+
+// Every glyph of a test font gets its own width and pixel pattern, so that drawing the wrong glyph shows up in the output
+uint8_t test_glyph_width(uint32_t code_point);
+uint8_t test_glyph_pixel(uint32_t code_point, uint8_t x, uint8_t y, uint8_t bpp);
+
+// Builds a grayscale QFF font with a full ascii table and the given unicode glyphs, in the given order
+std::vector<uint8_t> make_test_font(const std::vector<uint32_t> &unicode_glyphs, uint8_t line_height, uint8_t bpp = 1, painter_compression_t compression = IMAGE_UNCOMPRESSED);
+
+std::string utf8(uint32_t code_point);
@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "painter_test_image.hpp"
+#include "painter_test_codec.hpp"
+
+uint8_t test_image_pixel(uint16_t frame, uint16_t x, uint16_t y, uint8_t bpp) {
+    // Diagonal bands with a hole in the middle, moving by one band each frame
+    uint8_t band = ((x + y) / 4 + frame) & ((1 << bpp) - 1);
+    return ((x / 8) % 3 == 1 && (y / 8) % 3 == 1) ? 0 : band;
+}
+
+static std::vector<uint8_t> build_test_image(uint16_t width, uint16_t height, uint16_t frame_count, uint8_t bpp, bool has_palette, painter_compression_t compression, uint16_t delay, const std::vector<test_image_rect_t> *deltas) {
+    const uint8_t  bpp_index = bpp == 1 ? 0 : bpp == 2 ? 1 : bpp == 4 ? 2 : 3;
+    const uint8_t  format    = (has_palette ? 0x04 : 0x00) + bpp_index;
+    const uint16_t entries   = 1 << bpp;
+
+    std::vector<uint8_t>  frames;
+    std::vector<uint32_t> offsets;
+    const uint32_t        frames_start = 23 + 5 + frame_count * 4;
+    for (uint16_t frame = 0; frame < frame_count; ++frame) {
+        offsets.push_back(frames_start + frames.size());
+
+        // Delta frames only contain the pixels inside their rectangle
+        bool              is_delta = deltas && frame > 0;
+        test_image_rect_t rect     = is_delta ? (*deltas)[frame] : test_image_rect_t{0, 0, (uint16_t)(width - 1), (uint16_t)(height - 1)};
+
+        append_block_header(frames, 0x02, 6);
+        frames.push_back(format);                 // format
+        frames.push_back(is_delta ? 0x02 : 0x00); // flags
+        frames.push_back(compression);            // compression_scheme
+        frames.push_back(0xFF);                   // transparency_index
+        append_le(frames, delay, 2);              // delay
+
+        if (has_palette) {
+            append_block_header(frames, 0x03, entries * 3);
+            for (uint16_t i = 0; i < entries; ++i) {
+                frames.push_back(i * 256 / entries);            // h
+                frames.push_back(255);                          // s
+                frames.push_back(96 + i * 159 / (entries - 1)); // v
+            }
+        }
+
+        if (is_delta) {
+            append_block_header(frames, 0x04, 8);
+            append_le(frames, rect.left, 2);
+            append_le(frames, rect.top, 2);
+            append_le(frames, rect.right, 2);
+            append_le(frames, rect.bottom, 2);
+        }
+
+        std::vector<uint8_t> pixels;
+        for (uint16_t y = rect.top; y <= rect.bottom; ++y) {
+            for (uint16_t x = rect.left; x <= rect.right; ++x) {
+                pixels.push_back(test_image_pixel(frame, x, y, bpp));
+            }
+        }
+        std::vector<uint8_t> data = pack_pixels(pixels, bpp);
+        if (compression == IMAGE_COMPRESSED_RLE) {
+            data = rle_encode(data);
+        } else if (compression == IMAGE_COMPRESSED_LZ) {
+            data = lz_encode(data);
+        }
+        append_block_header(frames, 0x05, data.size());
+        frames.insert(frames.end(), data.begin(), data.end());
+    }
+
+    uint32_t             total_size = frames_start + frames.size();
+    std::vector<uint8_t> image;
+    append_block_header(image, 0x00, 18);
+    append_le(image, 0x464751, 3);    // magic
+    image.push_back(0x01);            // version
+    append_le(image, total_size, 4);  // total_file_size
+    append_le(image, ~total_size, 4); // neg_total_file_size
+    append_le(image, width, 2);       // image_width
+    append_le(image, height, 2);      // image_height
+    append_le(image, frame_count, 2); // frame_count
+    append_block_header(image, 0x01, frame_count * 4);
+    for (uint32_t offset : offsets) {
+        append_le(image, offset, 4);
+    }
+    image.insert(image.end(), frames.begin(), frames.end());
+    return image;
+}
+
+std::vector<uint8_t> make_test_image(uint16_t width, uint16_t height, uint16_t frame_count, uint8_t bpp, bool has_palette, painter_compression_t compression, uint16_t delay) {
+    return build_test_image(width, height, frame_count, bpp, has_palette, compression, delay, nullptr);
+}
+
+std::vector<uint8_t> make_test_delta_image(uint16_t width, uint16_t height, const std::vector<test_image_rect_t> &deltas, uint8_t bpp, painter_compression_t compression, uint16_t delay) {
+    return build_test_image(width, height, deltas.size(), bpp, false, compression, delay, &deltas);
+}
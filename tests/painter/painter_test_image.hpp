@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "qp_internal.h"
+}
+
+// Every frame of a test image gets its own pixel pattern, so that drawing the wrong frame shows up in the output
+uint8_t test_image_pixel(uint16_t frame, uint16_t x, uint16_t y, uint8_t bpp);
+
+// Builds a QGF image with the given number of frames, each shown for the given delay when animated. Palette images
+// get a rainbow palette, otherwise the frames are grayscale.
+std::vector<uint8_t> make_test_image(uint16_t width, uint16_t height, uint16_t frame_count, uint8_t bpp, bool has_palette = false, painter_compression_t compression = IMAGE_UNCOMPRESSED, uint16_t delay = 100);
+
+struct test_image_rect_t {
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+};
+
+// Builds an animated QGF image whose first frame is complete, while every later frame is a delta frame only containing
+// the pixels of the given rectangle. deltas[0] is unused, as the first frame always covers the whole image.
+std::vector<uint8_t> make_test_delta_image(uint16_t width, uint16_t height, const std::vector<test_image_rect_t> &deltas, uint8_t bpp, painter_compression_t compression = IMAGE_UNCOMPRESSED, uint16_t delay = 100);
@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "painter_test_png.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#    define mkdir(path, mode) mkdir(path)
+#endif
+
+std::vector<uint8_t> painter_test_rgb565_to_rgb888(const uint16_t *framebuffer, uint32_t pixel_count) {
+    std::vector<uint8_t> out;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        uint16_t rgb565 = __builtin_bswap16(framebuffer[i]);
+        uint8_t  r = (rgb565 >> 11) & 0x1F, g = (rgb565 >> 5) & 0x3F, b = rgb565 & 0x1F;
+        out.push_back((r << 3) | (r >> 2));
+        out.push_back((g << 2) | (g >> 4));
+        out.push_back((b << 3) | (b >> 2));
+    }
+    return out;
+}
+
+static uint32_t crc32(const uint8_t *data, size_t length, uint32_t crc = 0) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static void append_be(std::vector<uint8_t> &out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back((value >> shift) & 0xFF);
+    }
+}
+
+static void append_chunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data) {
+    append_be(out, data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    append_be(out, crc32(&out[start], out.size() - start));
+}
+
+// Wraps the data in a zlib stream made of stored (uncompressed) deflate blocks
+static std::vector<uint8_t> zlib_stored(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out = {0x78, 0x01};
+    uint32_t             a = 1, b = 0;
+    size_t               pos = 0;
+    do {
+        size_t length = std::min<size_t>(65535, data.size() - pos);
+        out.push_back(pos + length == data.size() ? 1 : 0);
+        out.push_back(length & 0xFF);
+        out.push_back(length >> 8);
+        out.push_back(~length & 0xFF);
+        out.push_back((~length >> 8) & 0xFF);
+        for (size_t i = pos; i < pos + length; ++i) {
+            out.push_back(data[i]);
+            a = (a + data[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        pos += length;
+    } while (pos < data.size());
+    append_be(out, (b << 16) | a);
+    return out;
+}
+
+bool painter_test_write_png(const std::string &path, uint16_t width, uint16_t height, const std::vector<uint8_t> &rgb888) {
+    // Each row starts with its filter type, 0 = none
+    std::vector<uint8_t> scanlines;
+    for (uint16_t y = 0; y < height; ++y) {
+        scanlines.push_back(0);
+        scanlines.insert(scanlines.end(), rgb888.begin() + y * width * 3, rgb888.begin() + (y + 1) * width * 3);
+    }
+
+    std::vector<uint8_t> header;
+    append_be(header, width);
+    append_be(header, height);
+    header.insert(header.end(), {8, 2, 0, 0, 0}); // 8 bits per channel, RGB, deflate, no filtering, not interlaced
+
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    append_chunk(png, "IHDR", header);
+    append_chunk(png, "IDAT", zlib_stored(scanlines));
+    append_chunk(png, "IEND", {});
+
+    // Create each missing directory along the way
+    for (size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1)) {
+        mkdir(path.substr(0, slash).c_str(), 0755);
+    }
+
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) {
+        return false;
+    }
+    bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+    return fclose(f) == 0 && ok;
+}
@@ -0,0 +1,15 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Converts the contents of an RGB565 surface's framebuffer, stored byte-swapped as sent to the panel, to RGB888
+std::vector<uint8_t> painter_test_rgb565_to_rgb888(const uint16_t *framebuffer, uint32_t pixel_count);
+
+// Writes RGB888 pixels to an uncompressed PNG file, creating the directory it's in if needed. Returns false if the
+// file couldn't be written.
+bool painter_test_write_png(const std::string &path, uint16_t width, uint16_t height, const std::vector<uint8_t> &rgb888);
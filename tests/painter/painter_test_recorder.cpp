@@ -0,0 +1,47 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "painter_test_recorder.hpp"
+
+extern "C" {
+#include "qp_internal.h"
+}
+
+static painter_driver_vtable_t        recording_vtable;
+static const painter_driver_vtable_t *device_vtable;
+static painter_test_transactions_t    transactions;
+
+static bool recording_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    transactions.viewport++;
+    return device_vtable->viewport(device, left, top, right, bottom);
+}
+
+static bool recording_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    transactions.pixdata++;
+    transactions.pixels += native_pixel_count;
+    return device_vtable->pixdata(device, pixel_data, native_pixel_count);
+}
+
+static bool recording_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    transactions.palette_convert++;
+    return device_vtable->palette_convert(device, palette_size, palette);
+}
+
+void painter_test_record_transactions(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (driver->driver_vtable != &recording_vtable) {
+        device_vtable                    = driver->driver_vtable;
+        recording_vtable                 = *device_vtable;
+        recording_vtable.viewport        = recording_viewport;
+        recording_vtable.pixdata         = recording_pixdata;
+        recording_vtable.palette_convert = recording_palette_convert;
+        driver->driver_vtable            = &recording_vtable;
+    }
+    transactions = {};
+}
+
+painter_test_transactions_t painter_test_take_transactions(void) {
+    painter_test_transactions_t ret = transactions;
+    transactions                    = {};
+    return ret;
+}
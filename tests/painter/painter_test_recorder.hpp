@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+
+extern "C" {
+#include "qp.h"
+}
+
+// Transactions sent to a device since recording started or was last reset. Each viewport and each pixdata call is a
+// separate command sequence on a real panel. Palette conversions don't reach the panel, but are counted alongside.
+typedef struct painter_test_transactions_t {
+    uint32_t viewport;
+    uint32_t pixdata;
+    uint32_t pixels;
+    uint32_t palette_convert;
+} painter_test_transactions_t;
+
+// Starts counting the transactions sent to the device. Only one device can be recorded at a time.
+void painter_test_record_transactions(painter_device_t device);
+
+// Returns the transactions counted so far, and resets the counts
+painter_test_transactions_t painter_test_take_transactions(void);
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Two displays of the same type, to check palettes aren't shared between them
+#define SURFACE_NUM_DEVICES 2
@@ -0,0 +1,116 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../painter_test_font.hpp"
+#include "../painter_test_recorder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+static const uint8_t  line_height = 10;
+static const uint16_t panel_width = 120;
+
+static uint16_t         framebuffer[2][panel_width * line_height];
+static painter_device_t surface[2];
+
+struct color_scheme_t {
+    uint8_t fg_hue, fg_sat, fg_val;
+    uint8_t bg_hue, bg_sat, bg_val;
+};
+
+// More schemes than fit in the cache
+static const color_scheme_t schemes[QUANTUM_PAINTER_PALETTE_CACHE_SIZE + 1] = {
+    {0, 255, 255, 85, 255, 128}, {43, 255, 255, 0, 0, 0}, {170, 255, 255, 0, 0, 255}, {128, 128, 255, 213, 255, 64}, {21, 255, 192, 0, 0, 32},
+};
+
+class PaletteCache : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same ones
+    static void SetUpTestSuite() {
+        for (int i = 0; i < 2; ++i) {
+            surface[i] = qp_make_rgb565_surface(panel_width, line_height, framebuffer[i]);
+            qp_init(surface[i], QP_ROTATION_0);
+            painter_test_record_transactions(surface[i]);
+        }
+    }
+
+    void SetUp() override {
+        font_data = make_test_font({}, line_height, 2);
+        font      = qp_load_font_mem(font_data.data());
+        ASSERT_NE(font, nullptr);
+
+        // Push any palettes left over from earlier tests out of the cache
+        for (int i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_SIZE; ++i) {
+            qp_drawtext_recolor(surface[1], 0, 0, font, "x", i, 1, 1, 0, 0, 0);
+        }
+        memset(framebuffer, 0x55, sizeof(framebuffer));
+        painter_test_take_transactions();
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    // Draws the test string in the given colors, returning a copy of the surface
+    std::vector<uint16_t> draw(int index, const color_scheme_t &scheme) {
+        EXPECT_NE(qp_drawtext_recolor(surface[index], 0, 0, font, "Palette!", scheme.fg_hue, scheme.fg_sat, scheme.fg_val, scheme.bg_hue, scheme.bg_sat, scheme.bg_val), 0);
+        return std::vector<uint16_t>(framebuffer[index], framebuffer[index] + panel_width * line_height);
+    }
+
+    std::vector<uint8_t>  font_data;
+    painter_font_handle_t font;
+};
+
+TEST_F(PaletteCache, RepeatedColorsConvertOnce) {
+    draw(0, schemes[0]);
+    draw(0, schemes[0]);
+    draw(0, schemes[0]);
+    EXPECT_EQ(painter_test_take_transactions().palette_convert, 1);
+}
+
+TEST_F(PaletteCache, AlternatingColorsConvertOncePerScheme) {
+    for (int i = 0; i < 10; ++i) {
+        draw(0, schemes[i % QUANTUM_PAINTER_PALETTE_CACHE_SIZE]);
+    }
+    EXPECT_EQ(painter_test_take_transactions().palette_convert, QUANTUM_PAINTER_PALETTE_CACHE_SIZE);
+}
+
+TEST_F(PaletteCache, CachedPaletteDrawsTheSamePixels) {
+    std::vector<uint16_t> first = draw(0, schemes[0]);
+    std::vector<uint16_t> other = draw(0, schemes[1]);
+    EXPECT_NE(first, other);
+
+    memset(framebuffer, 0x55, sizeof(framebuffer));
+    EXPECT_EQ(draw(0, schemes[0]), first);
+    EXPECT_EQ(painter_test_take_transactions().palette_convert, 2);
+}
+
+TEST_F(PaletteCache, OldestSchemeIsEvicted) {
+    for (const color_scheme_t &scheme : schemes) {
+        draw(0, scheme);
+    }
+    EXPECT_EQ(painter_test_take_transactions().palette_convert, QUANTUM_PAINTER_PALETTE_CACHE_SIZE + 1);
+
+    // The most recent schemes are still cached, the first one has to be converted again
+    draw(0, schemes[QUANTUM_PAINTER_PALETTE_CACHE_SIZE]);
+    draw(0, schemes[1]);
+    EXPECT_EQ(painter_test_take_transactions().palette_convert, 0);
+    draw(0, schemes[0]);
+    EXPECT_EQ(painter_test_take_transactions().palette_convert, 1);
+}
+
+TEST_F(PaletteCache, PalettesAreKeptPerDevice) {
+    std::vector<uint16_t> first = draw(0, schemes[0]);
+    EXPECT_EQ(draw(1, schemes[0]), first);
+    EXPECT_EQ(painter_test_take_transactions().palette_convert, 2);
+
+    draw(0, schemes[0]);
+    draw(1, schemes[0]);
+    EXPECT_EQ(painter_test_take_transactions().palette_convert, 0);
+}
@@ -0,0 +1,237 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "../painter_test_recorder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+static const uint16_t panel_size = 128;
+
+static uint16_t         framebuffer[panel_size * panel_size];
+static painter_device_t surface;
+
+typedef std::set<std::pair<int16_t, int16_t>> pixel_set;
+
+// Reference rasterizers, plotting the same points as the original point by point implementations
+
+static pixel_set reference_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    pixel_set pixels;
+    int16_t   x = x0, y = y0;
+    int16_t   slopex = x0 < x1 ? 1 : -1, slopey = y0 < y1 ? 1 : -1;
+    int16_t   dx = abs(x1 - x0), dy = -abs(y1 - y0);
+    int16_t   e = dx + dy;
+    while (x != x1 || y != y1) {
+        pixels.insert({x, y});
+        int16_t e2 = 2 * e;
+        if (e2 >= dy) {
+            e += dy;
+            x += slopex;
+        }
+        if (e2 <= dx) {
+            e += dx;
+            y += slopey;
+        }
+    }
+    pixels.insert({x, y});
+    return pixels;
+}
+
+static void plot_circle_points(pixel_set &pixels, int16_t cx, int16_t cy, int16_t ox, int16_t oy, bool filled) {
+    for (int16_t sx : {-1, 1}) {
+        for (int16_t sy : {-1, 1}) {
+            if (filled) {
+                for (int16_t x = -ox; x <= ox; ++x) pixels.insert({cx + x, cy + sy * oy});
+                for (int16_t x = -oy; x <= oy; ++x) pixels.insert({cx + x, cy + sy * ox});
+            } else {
+                pixels.insert({cx + sx * ox, cy + sy * oy});
+                pixels.insert({cx + sx * oy, cy + sy * ox});
+            }
+        }
+    }
+}
+
+static pixel_set reference_circle(int16_t cx, int16_t cy, int16_t radius, bool filled) {
+    pixel_set pixels;
+    int16_t   xcalc = 0, ycalc = radius;
+    int16_t   err = ((5 - (radius >> 2)) >> 2);
+    plot_circle_points(pixels, cx, cy, xcalc, ycalc, filled);
+    while (xcalc < ycalc) {
+        xcalc++;
+        if (err < 0) {
+            err += (xcalc << 1) + 1;
+        } else {
+            ycalc--;
+            err += ((xcalc - ycalc) << 1) + 1;
+        }
+        plot_circle_points(pixels, cx, cy, xcalc, ycalc, filled);
+    }
+    return pixels;
+}
+
+static void plot_ellipse_points(pixel_set &pixels, int16_t cx, int16_t cy, int16_t ox, int16_t oy, bool filled) {
+    for (int16_t sx : {-1, 1}) {
+        for (int16_t sy : {-1, 1}) {
+            if (filled) {
+                for (int16_t x = -ox; x <= ox; ++x) pixels.insert({cx + x, cy + sy * oy});
+            } else {
+                pixels.insert({cx + sx * ox, cy + sy * oy});
+            }
+        }
+    }
+}
+
+static pixel_set reference_ellipse(int16_t cx, int16_t cy, int16_t sizex, int16_t sizey, bool filled) {
+    pixel_set pixels;
+    int32_t   aa = sizex * sizex, bb = sizey * sizey;
+    int32_t   fa = 4 * aa, fb = 4 * bb;
+    int16_t   dx = 0, dy = sizey;
+    for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+        plot_ellipse_points(pixels, cx, cy, dx, dy, filled);
+        if (delta >= 0) {
+            delta += fa * (1 - dy);
+            dy--;
+        }
+        delta += bb * (4 * dx + 6);
+    }
+    dx = sizex;
+    dy = 0;
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+        plot_ellipse_points(pixels, cx, cy, dx, dy, filled);
+        if (delta >= 0) {
+            delta += fb * (1 - dx);
+            dx--;
+        }
+        delta += aa * (4 * dy + 6);
+    }
+    return pixels;
+}
+
+class Primitives : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same one
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(panel_size, panel_size, framebuffer);
+        qp_init(surface, QP_ROTATION_0);
+        painter_test_record_transactions(surface);
+    }
+
+    void SetUp() override {
+        memset(framebuffer, 0, sizeof(framebuffer));
+        painter_test_take_transactions();
+    }
+
+    pixel_set drawn_pixels() {
+        pixel_set pixels;
+        for (int16_t y = 0; y < panel_size; ++y) {
+            for (int16_t x = 0; x < panel_size; ++x) {
+                if (framebuffer[y * panel_size + x] != 0) {
+                    EXPECT_EQ(framebuffer[y * panel_size + x], 0xFFFF);
+                    pixels.insert({x, y});
+                }
+            }
+        }
+        return pixels;
+    }
+};
+
+TEST_F(Primitives, LineIsDrawnAsOneRunPerRow) {
+    ASSERT_TRUE(qp_line(surface, 10, 20, 110, 30, 0, 0, 255));
+    EXPECT_EQ(drawn_pixels(), reference_line(10, 20, 110, 30));
+
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 11);
+    EXPECT_EQ(transactions.pixels, 101);
+}
+
+TEST_F(Primitives, SteepLineIsDrawnAsOneRunPerColumn) {
+    ASSERT_TRUE(qp_line(surface, 60, 120, 55, 5, 0, 0, 255));
+    EXPECT_EQ(drawn_pixels(), reference_line(60, 120, 55, 5));
+
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 6);
+    EXPECT_EQ(transactions.pixels, 116);
+}
+
+TEST_F(Primitives, LinesMatchReferenceInAllDirections) {
+    const int16_t ends[][2] = {{0, 0}, {127, 0}, {127, 127}, {0, 127}, {64, 0}, {127, 64}, {64, 127}, {0, 64}, {100, 3}, {3, 90}, {77, 76}};
+    for (auto &end : ends) {
+        SCOPED_TRACE(testing::Message() << end[0] << "," << end[1]);
+        SetUp();
+        ASSERT_TRUE(qp_line(surface, 63, 63, end[0], end[1], 0, 0, 255));
+        EXPECT_EQ(drawn_pixels(), reference_line(63, 63, end[0], end[1]));
+    }
+}
+
+TEST_F(Primitives, CirclesMatchReference) {
+    for (bool filled : {false, true}) {
+        for (uint16_t radius : {0, 1, 2, 3, 5, 8, 13, 30, 60}) {
+            SCOPED_TRACE(testing::Message() << "radius " << radius << (filled ? " filled" : " outline"));
+            SetUp();
+            ASSERT_TRUE(qp_circle(surface, 63, 63, radius, 0, 0, 255, filled));
+            pixel_set expected = reference_circle(63, 63, radius, filled);
+            EXPECT_EQ(drawn_pixels(), expected);
+
+            // Outlines take at most one transaction per two pixels, filled circles less than one per row
+            painter_test_transactions_t transactions = painter_test_take_transactions();
+            if (radius >= 13) {
+                EXPECT_LE(transactions.viewport, filled ? radius * 2 : expected.size() / 2);
+            }
+        }
+    }
+}
+
+TEST_F(Primitives, EllipsesMatchReference) {
+    const uint16_t sizes[][2] = {{0, 5}, {5, 0}, {1, 1}, {5, 2}, {2, 5}, {20, 8}, {8, 20}, {60, 30}, {30, 60}, {40, 40}};
+    for (bool filled : {false, true}) {
+        for (auto &size : sizes) {
+            SCOPED_TRACE(testing::Message() << size[0] << "x" << size[1] << (filled ? " filled" : " outline"));
+            SetUp();
+            ASSERT_TRUE(qp_ellipse(surface, 63, 63, size[0], size[1], 0, 0, 255, filled));
+            pixel_set expected = reference_ellipse(63, 63, size[0], size[1], filled);
+            EXPECT_EQ(drawn_pixels(), expected);
+
+            // Outlines take at most one transaction per two pixels, filled ellipses less than one per row
+            painter_test_transactions_t transactions = painter_test_take_transactions();
+            if (size[0] >= 20 && size[1] >= 20) {
+                EXPECT_LE(transactions.viewport, filled ? size[1] * 2 : expected.size() / 2);
+            }
+        }
+    }
+}
+
+// Only the part of a shape that is on the panel is drawn, runs crossing an edge must not wrap around to the other side
+static pixel_set on_panel(const pixel_set &pixels) {
+    pixel_set visible;
+    for (auto &pixel : pixels) {
+        if (pixel.first >= 0 && pixel.first < panel_size && pixel.second >= 0 && pixel.second < panel_size) {
+            visible.insert(pixel);
+        }
+    }
+    return visible;
+}
+
+TEST_F(Primitives, ShapesStraddlingEdgesAreClipped) {
+    const int16_t centers[][2] = {{5, 63}, {63, 5}, {122, 63}, {63, 122}, {3, 4}, {124, 125}};
+    for (bool filled : {false, true}) {
+        for (auto &center : centers) {
+            SCOPED_TRACE(testing::Message() << center[0] << "," << center[1] << (filled ? " filled" : " outline"));
+
+            SetUp();
+            ASSERT_TRUE(qp_circle(surface, center[0], center[1], 20, 0, 0, 255, filled));
+            EXPECT_EQ(drawn_pixels(), on_panel(reference_circle(center[0], center[1], 20, filled)));
+
+            SetUp();
+            ASSERT_TRUE(qp_ellipse(surface, center[0], center[1], 30, 12, 0, 0, 255, filled));
+            EXPECT_EQ(drawn_pixels(), on_panel(reference_ellipse(center[0], center[1], 30, 12, filled)));
+        }
+    }
+}
@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../painter_test_font.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+static const uint8_t  line_height = 8;
+static const uint16_t panel_width = 512;
+
+static uint16_t         framebuffer[panel_width * line_height];
+static painter_device_t surface;
+
+class QffUnicode : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same one
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(panel_width, line_height, framebuffer);
+        qp_init(surface, QP_ROTATION_0);
+    }
+
+    void SetUp() override {
+        for (uint16_t i = 0; i < 600; ++i) {
+            unicode_glyphs.push_back(0x4E00 + i * 3);
+        }
+        font_data = make_test_font(unicode_glyphs, line_height);
+
+        ASSERT_NE(surface, nullptr);
+        font = qp_load_font_mem(font_data.data());
+        ASSERT_NE(font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    // A mix of ascii, and unicode glyphs from all over the table with plenty of repeats
+    std::vector<uint32_t> mixed_code_points(size_t count) {
+        std::vector<uint32_t> code_points;
+        for (size_t i = 0; i < count; ++i) {
+            if (i % 3 == 0) {
+                code_points.push_back('A' + i % 26);
+            } else {
+                code_points.push_back(unicode_glyphs[(i * 37) % (i % 2 ? 12 : unicode_glyphs.size())]);
+            }
+        }
+        return code_points;
+    }
+
+    void expect_drawn(const std::vector<uint32_t> &code_points) {
+        uint16_t x = 0;
+        for (uint32_t code_point : code_points) {
+            for (uint8_t gx = 0; gx < test_glyph_width(code_point); ++gx) {
+                for (uint8_t gy = 0; gy < line_height; ++gy) {
+                    uint16_t expected = test_glyph_pixel(code_point, gx, gy, 1) ? 0xFFFF : 0x0000;
+                    ASSERT_EQ(framebuffer[gy * panel_width + x + gx], expected) << "code point " << code_point << " at " << (int)gx << "," << (int)gy;
+                }
+            }
+            x += test_glyph_width(code_point);
+        }
+    }
+
+    std::vector<uint32_t> unicode_glyphs;
+    std::vector<uint8_t>  font_data;
+    painter_font_handle_t font;
+};
+
+TEST_F(QffUnicode, DrawsMixedStrings) {
+    std::vector<uint32_t> code_points = mixed_code_points(80);
+    std::string           str;
+    int16_t               width = 0;
+    for (uint32_t code_point : code_points) {
+        str += utf8(code_point);
+        width += test_glyph_width(code_point);
+    }
+    ASSERT_LE(width, panel_width);
+
+    EXPECT_EQ(qp_textwidth(font, str.c_str()), width);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, str.c_str()), width);
+    expect_drawn(code_points);
+}
+
+TEST_F(QffUnicode, FindsFirstAndLastGlyphs) {
+    std::vector<uint32_t> code_points = {unicode_glyphs.front(), unicode_glyphs.back(), unicode_glyphs[1], unicode_glyphs[unicode_glyphs.size() - 2]};
+    std::string           str;
+    for (uint32_t code_point : code_points) {
+        str += utf8(code_point);
+    }
+
+    EXPECT_NE(qp_drawtext(surface, 0, 0, font, str.c_str()), 0);
+    expect_drawn(code_points);
+}
+
+TEST_F(QffUnicode, MissingGlyphFails) {
+    // Between two glyphs, before the first and after the last
+    EXPECT_EQ(qp_textwidth(font, utf8(unicode_glyphs[0] + 1).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x00E9).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(0xFFFF).c_str()), 0);
+}
+
+TEST_F(QffUnicode, CachedGlyphsStayCorrectAfterEviction) {
+    // More distinct glyphs than the cache holds, drawn twice so the second pass mixes hits and misses
+    std::vector<uint32_t> code_points;
+    for (uint8_t i = 0; i < 2; ++i) {
+        for (uint16_t j = 0; j < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE + 4; ++j) {
+            code_points.push_back(unicode_glyphs[j * 41]);
+        }
+    }
+    code_points.push_back(unicode_glyphs[0]);
+    std::string str;
+    for (uint32_t code_point : code_points) {
+        str += utf8(code_point);
+    }
+
+    EXPECT_NE(qp_drawtext(surface, 0, 0, font, str.c_str()), 0);
+    expect_drawn(code_points);
+}
+
+TEST_F(QffUnicode, UnsortedTableIsRejected) {
+    std::vector<uint32_t> unsorted      = {0x4E00, 0x4E10, 0x4E08};
+    std::vector<uint8_t>  unsorted_font = make_test_font(unsorted, line_height);
+    EXPECT_EQ(qp_load_font_mem(unsorted_font.data()), nullptr);
+}
+
+TEST_F(QffUnicode, Benchmark) {
+    std::string str;
+    for (uint32_t code_point : mixed_code_points(80)) {
+        str += utf8(code_point);
+    }
+
+    const int iterations = 500;
+    auto      start      = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        qp_drawtext(surface, 0, 0, font, str.c_str());
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    printf("%d draws of 80 glyphs with %d unicode glyphs in the font: %ldus per draw\n", iterations, (int)unicode_glyphs.size(), (long)(elapsed.count() / iterations));
+}
@@ -0,0 +1,189 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../painter_test_font.hpp"
+#include "../painter_test_image.hpp"
+#include "../painter_test_png.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+
+void advance_time(uint32_t ms);
+void qp_internal_animation_tick(void);
+}
+
+// Renders scripted scenes on a host surface, writing each one out as a PNG and timing how long it takes to draw. The
+// expected checksums catch visual regressions -- if a rendering change is intentional, check the PNGs and update them.
+// PNGs go to .build/test/painter_render unless QP_TEST_RENDER_DIR says otherwise.
+
+static const uint16_t panel_width     = 240;
+static const uint16_t panel_height    = 135;
+static const int      timing_repeats  = 50;
+static const uint16_t animation_delay = 40;
+
+static uint16_t         framebuffer[panel_width * panel_height];
+static painter_device_t surface;
+
+static std::vector<std::vector<uint8_t>> assets;
+
+class RenderScenes : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same one
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(panel_width, panel_height, framebuffer);
+        qp_init(surface, QP_ROTATION_0);
+    }
+
+    void SetUp() override {
+        memset(framebuffer, 0, sizeof(framebuffer));
+    }
+
+    void TearDown() override {
+        for (painter_font_handle_t font : fonts) {
+            qp_close_font(font);
+        }
+        for (painter_image_handle_t image : images) {
+            qp_close_image(image);
+        }
+        assets.clear();
+    }
+
+    painter_font_handle_t load_font(std::vector<uint8_t> data) {
+        assets.push_back(std::move(data));
+        painter_font_handle_t font = qp_load_font_mem(assets.back().data());
+        EXPECT_NE(font, nullptr);
+        fonts.push_back(font);
+        return font;
+    }
+
+    painter_image_handle_t load_image(std::vector<uint8_t> data) {
+        assets.push_back(std::move(data));
+        painter_image_handle_t image = qp_load_image_mem(assets.back().data());
+        EXPECT_NE(image, nullptr);
+        images.push_back(image);
+        return image;
+    }
+
+    // Writes the surface out as <name>.png, returning a checksum of its contents
+    uint32_t capture(const std::string &name) {
+        const char *dir  = getenv("QP_TEST_RENDER_DIR");
+        std::string path = std::string(dir ? dir : ".build/test/painter_render") + "/" + name + ".png";
+        EXPECT_TRUE(painter_test_write_png(path, panel_width, panel_height, painter_test_rgb565_to_rgb888(framebuffer, panel_width * panel_height))) << "could not write " << path;
+
+        // FNV-1a
+        uint32_t       hash  = 2166136261u;
+        const uint8_t *bytes = (const uint8_t *)framebuffer;
+        for (size_t i = 0; i < sizeof(framebuffer); ++i) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    // Renders the scene once for the PNG and checksum, then repeatedly to time it
+    uint32_t render(const std::string &name, const std::function<void()> &scene) {
+        scene();
+        uint32_t hash = capture(name);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < timing_repeats; ++i) {
+            scene();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        printf("%s: %ldus per render, checksum 0x%08X\n", name.c_str(), (long)(elapsed.count() / timing_repeats), (unsigned)hash);
+        return hash;
+    }
+
+    std::vector<painter_font_handle_t>  fonts;
+    std::vector<painter_image_handle_t> images;
+};
+
+TEST_F(RenderScenes, Primitives) {
+    uint32_t hash = render("primitives", [] {
+        qp_rect(surface, 0, 0, panel_width - 1, panel_height - 1, 0, 0, 32, true);
+        qp_rect(surface, 4, 4, 75, 60, 0, 255, 255, false);
+        qp_rect(surface, 10, 10, 69, 54, 43, 255, 255, true);
+        for (uint16_t i = 0; i < 8; ++i) {
+            qp_line(surface, 84, 4 + i * 8, 155, 60 - i * 8, i * 32, 255, 255);
+        }
+        qp_line(surface, 84, 32, 155, 32, 0, 0, 255);
+        qp_circle(surface, 200, 32, 28, 85, 255, 255, false);
+        qp_circle(surface, 200, 32, 18, 128, 255, 255, true);
+        qp_ellipse(surface, 40, 100, 36, 24, 170, 255, 255, true);
+        qp_ellipse(surface, 40, 100, 36, 24, 0, 0, 255, false);
+        qp_ellipse(surface, 120, 100, 12, 30, 213, 255, 255, false);
+        for (uint16_t y = 70; y < 130; y += 4) {
+            for (uint16_t x = 150; x < 236; x += 4) {
+                qp_setpixel(surface, x, y, x + y, 255, 255);
+            }
+        }
+    });
+    EXPECT_EQ(hash, 0xDA2B8B3C);
+}
+
+TEST_F(RenderScenes, Text) {
+    const std::vector<uint32_t> unicode = {0x00E9, 0x03A9, 0x4E2D, 0x6587};
+    painter_font_handle_t       small   = load_font(make_test_font(unicode, 12, 1));
+    painter_font_handle_t       large   = load_font(make_test_font(unicode, 24, 4, IMAGE_COMPRESSED_LZ));
+    const std::string           mixed   = "Caf" + utf8(0x00E9) + " " + utf8(0x03A9) + " " + utf8(0x4E2D) + utf8(0x6587);
+
+    uint32_t hash = render("text", [&] {
+        qp_drawtext(surface, 4, 4, small, "The quick brown fox jumps over the lazy dog");
+        qp_drawtext_recolor(surface, 4, 20, small, "Recolored 1bpp text", 0, 255, 255, 170, 255, 64);
+        qp_drawtext_recolor(surface, 4, 36, small, mixed.c_str(), 85, 255, 255, 0, 0, 0);
+        qp_drawtext_recolor(surface, 4, 56, large, "4bpp LZ", 43, 255, 255, 0, 0, 0);
+        qp_drawtext_recolor(surface, 4, 84, large, mixed.c_str(), 128, 128, 255, 213, 255, 96);
+        qp_drawtext(surface, 4, 112, small, "0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~");
+    });
+    EXPECT_EQ(hash, 0x8D1EF12E);
+}
+
+TEST_F(RenderScenes, Images) {
+    painter_image_handle_t gray1   = load_image(make_test_image(64, 64, 1, 1));
+    painter_image_handle_t gray4   = load_image(make_test_image(64, 64, 1, 4, false, IMAGE_COMPRESSED_RLE));
+    painter_image_handle_t palette = load_image(make_test_image(64, 64, 1, 4, true));
+    painter_image_handle_t lz      = load_image(make_test_image(64, 64, 1, 2, true, IMAGE_COMPRESSED_LZ));
+
+    uint32_t hash = render("images", [&] {
+        qp_drawimage(surface, 8, 4, gray1);
+        qp_drawimage_recolor(surface, 88, 4, gray4, 0, 255, 255, 170, 255, 64);
+        qp_drawimage(surface, 168, 4, palette);
+        qp_drawimage(surface, 8, 70, lz);
+        qp_drawimage_recolor(surface, 88, 70, gray1, 85, 255, 255, 213, 255, 128);
+        qp_drawimage(surface, 168, 70, gray4);
+    });
+    EXPECT_EQ(hash, 0xF3EA93D9);
+}
+
+TEST_F(RenderScenes, Animation) {
+    const uint16_t         frame_count = 4;
+    painter_image_handle_t animation   = load_image(make_test_image(96, 96, frame_count, 4, true, IMAGE_COMPRESSED_RLE, animation_delay));
+
+    // The first frame is drawn straight away, each following one once its predecessor's delay has passed
+    deferred_token token = qp_animate(surface, 72, 20, animation);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+
+    std::vector<uint32_t> hashes;
+    for (uint16_t frame = 0; frame <= frame_count; ++frame) {
+        if (frame > 0) {
+            advance_time(animation_delay);
+            auto start = std::chrono::steady_clock::now();
+            qp_internal_animation_tick();
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            printf("animation frame %d: %ldus per render\n", (int)(frame % frame_count), (long)elapsed.count());
+        }
+        hashes.push_back(capture("animation_" + std::to_string(frame % frame_count)));
+    }
+    qp_stop_animation(token);
+
+    // The animation loops back around to the first frame
+    EXPECT_EQ(hashes, (std::vector<uint32_t>{0x734EE4B5, 0x7721A70D, 0x8EE00C5D, 0xB30B1DA5, 0x734EE4B5}));
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// One surface to draw on, and one standing in for the display it's transferred to
+#define SURFACE_NUM_DEVICES 2
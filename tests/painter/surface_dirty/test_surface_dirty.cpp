@@ -0,0 +1,147 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+#include "../painter_test_recorder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+static const uint16_t panel_width  = 240;
+static const uint16_t panel_height = 320;
+
+static uint16_t         surface_buffer[panel_width * panel_height];
+static uint16_t         display_buffer[panel_width * panel_height];
+static painter_device_t surface;
+static painter_device_t display;
+
+class SurfaceDirty : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same ones
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(panel_width, panel_height, surface_buffer);
+        display = qp_make_rgb565_surface(panel_width, panel_height, display_buffer);
+        qp_init(surface, QP_ROTATION_0);
+        qp_init(display, QP_ROTATION_0);
+        painter_test_record_transactions(display);
+    }
+
+    // Starts every test with both surfaces cleared and in sync
+    void SetUp() override {
+        qp_clear(surface);
+        qp_clear(display);
+        qp_surface_draw(surface, display, 0, 0, false);
+        painter_test_take_transactions();
+    }
+
+    void expect_display_matches_surface() {
+        EXPECT_EQ(memcmp(surface_buffer, display_buffer, sizeof(surface_buffer)), 0);
+    }
+};
+
+TEST_F(SurfaceDirty, InitialDrawTransfersEverything) {
+    qp_clear(surface);
+    qp_clear(display);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 1);
+    EXPECT_EQ(transactions.pixels, panel_width * panel_height);
+}
+
+TEST_F(SurfaceDirty, CleanSurfaceTransfersNothing) {
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 0);
+    EXPECT_EQ(transactions.pixels, 0);
+}
+
+TEST_F(SurfaceDirty, SingleAreaTransfersOnlyItsPixels) {
+    qp_rect(surface, 37, 45, 56, 54, 0, 255, 255, true);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 1);
+    EXPECT_EQ(transactions.pixels, 20 * 10);
+    expect_display_matches_surface();
+}
+
+TEST_F(SurfaceDirty, OppositeCornersTransferSeparately) {
+    // A clock in the top left, and a layer indicator in the bottom right
+    qp_rect(surface, 4, 4, 43, 15, 0, 255, 255, true);
+    qp_rect(surface, 220, 300, 235, 315, 85, 255, 255, true);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+
+    // Tiles are 16x32 for a 240x320 surface, so each area is transferred as the tiles it touches, clipped to the
+    // overall dirty region of 4,4 - 235,315
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 2);
+    EXPECT_EQ(transactions.pixels, (47 - 4 + 1) * (31 - 4 + 1) + (235 - 208 + 1) * (315 - 288 + 1));
+    EXPECT_LT(transactions.pixels, (235 - 4 + 1) * (315 - 4 + 1) / 30);
+    expect_display_matches_surface();
+}
+
+TEST_F(SurfaceDirty, MatchingRowsOfTilesAreMerged) {
+    // Each spans several rows of tiles with the same columns, so each is one rectangle
+    qp_rect(surface, 100, 10, 120, 200, 0, 255, 255, true);
+    qp_rect(surface, 10, 250, 20, 260, 0, 255, 255, true);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+
+    // Tile columns 6-7 and rows 0-6, then tile columns 0-1 and rows 7-8, clipped to the dirty region of 10,10 - 120,260
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 2);
+    EXPECT_EQ(transactions.pixels, (120 - 96 + 1) * (223 - 10 + 1) + (31 - 10 + 1) * (260 - 224 + 1));
+    expect_display_matches_surface();
+}
+
+TEST_F(SurfaceDirty, MostlyDirtyRegionIsTransferredWhole) {
+    // Two rectangles of tiles, which would transfer all but 32x9 pixels of the dirty region
+    qp_rect(surface, 0, 0, 239, 20, 0, 255, 255, true);
+    qp_rect(surface, 0, 30, 200, 40, 170, 255, 255, true);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 1);
+    EXPECT_EQ(transactions.pixels, 240 * 41);
+    expect_display_matches_surface();
+}
+
+TEST_F(SurfaceDirty, UnchangedPixelsAreNotDirty) {
+    qp_rect(surface, 10, 10, 20, 20, 0, 255, 255, true);
+    qp_surface_draw(surface, display, 0, 0, false);
+    painter_test_take_transactions();
+
+    // Redrawing the same thing doesn't change anything
+    qp_rect(surface, 10, 10, 20, 20, 0, 255, 255, true);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    EXPECT_EQ(painter_test_take_transactions().pixels, 0);
+}
+
+TEST_F(SurfaceDirty, EntireSurfaceIgnoresDirtyTiles) {
+    qp_rect(surface, 10, 10, 20, 20, 0, 255, 255, true);
+    EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, true));
+
+    painter_test_transactions_t transactions = painter_test_take_transactions();
+    EXPECT_EQ(transactions.viewport, 1);
+    EXPECT_EQ(transactions.pixels, panel_width * panel_height);
+    expect_display_matches_surface();
+}
+
+TEST_F(SurfaceDirty, ScatteredDrawsStayInSync) {
+    uint32_t seed = 1;
+    for (int frame = 0; frame < 20; ++frame) {
+        for (int i = 0; i < 5; ++i) {
+            seed       = seed * 1103515245 + 12345;
+            uint16_t x = (seed >> 8) % (panel_width - 30);
+            uint16_t y = (seed >> 20) % (panel_height - 30);
+            qp_rect(surface, x, y, x + (seed & 15) + 1, y + ((seed >> 4) & 15) + 1, seed & 0xFF, 255, 255, true);
+        }
+        EXPECT_TRUE(qp_surface_draw(surface, display, 0, 0, false));
+    }
+    expect_display_matches_surface();
+}
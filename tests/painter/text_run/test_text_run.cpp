@@ -0,0 +1,133 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../painter_test_font.hpp"
+#include "../painter_test_recorder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+static const uint8_t  line_height = 10;
+static const uint16_t panel_width = 480;
+
+static uint16_t         framebuffer[panel_width * line_height];
+static painter_device_t surface;
+
+class TextRun : public ::testing::Test {
+   protected:
+    // Surfaces can't be released, so all tests share the same one
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(panel_width, line_height, framebuffer);
+        qp_init(surface, QP_ROTATION_0);
+        painter_test_record_transactions(surface);
+    }
+
+    void SetUp() override {
+        memset(framebuffer, 0x55, sizeof(framebuffer));
+        painter_test_take_transactions();
+    }
+
+    // Draws the string with the given font, returning a copy of the surface
+    std::vector<uint16_t> draw(const std::vector<uint8_t> &font_data, const std::string &str, int16_t expected_width) {
+        painter_font_handle_t font = qp_load_font_mem(font_data.data());
+        EXPECT_NE(font, nullptr);
+        EXPECT_EQ(qp_drawtext_recolor(surface, 0, 0, font, str.c_str(), 0, 255, 255, 85, 255, 128), expected_width);
+        qp_close_font(font);
+        return std::vector<uint16_t>(framebuffer, framebuffer + panel_width * line_height);
+    }
+
+    std::vector<uint32_t> unicode_glyphs = {0x00E9, 0x03A9, 0x4E2D, 0x6587};
+};
+
+static std::vector<uint32_t> mixed_code_points(size_t count) {
+    std::vector<uint32_t> code_points;
+    const uint32_t        unicode[] = {0x00E9, 0x03A9, 0x4E2D, 0x6587};
+    for (size_t i = 0; i < count; ++i) {
+        code_points.push_back(i % 4 == 3 ? unicode[i % 16 / 4] : (uint32_t)('!' + (i * 7) % 94));
+    }
+    return code_points;
+}
+
+static std::string to_string(const std::vector<uint32_t> &code_points, int16_t *width) {
+    std::string str;
+    *width = 0;
+    for (uint32_t code_point : code_points) {
+        str += utf8(code_point);
+        *width += test_glyph_width(code_point);
+    }
+    return str;
+}
+
+TEST_F(TextRun, UncompressedFontUsesOneViewport) {
+    std::vector<uint32_t> code_points = mixed_code_points(20);
+    int16_t               width;
+    std::string           str = to_string(code_points, &width);
+
+    std::vector<uint8_t>  font_data = make_test_font(unicode_glyphs, line_height);
+    painter_font_handle_t font      = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, str.c_str()), width);
+    qp_close_font(font);
+    EXPECT_EQ(painter_test_take_transactions().viewport, 1);
+
+    uint16_t x = 0;
+    for (uint32_t code_point : code_points) {
+        for (uint8_t gy = 0; gy < line_height; ++gy) {
+            for (uint8_t gx = 0; gx < test_glyph_width(code_point); ++gx) {
+                uint16_t expected = test_glyph_pixel(code_point, gx, gy, 1) ? 0xFFFF : 0x0000;
+                ASSERT_EQ(framebuffer[gy * panel_width + x + gx], expected) << "code point " << code_point << " at " << (int)gx << "," << (int)gy;
+            }
+        }
+        x += test_glyph_width(code_point);
+    }
+    // Nothing is drawn past the end of the run
+    EXPECT_EQ(framebuffer[x], 0x5555);
+}
+
+TEST_F(TextRun, CompressedFontUsesOneViewportPerGlyph) {
+    std::vector<uint32_t> code_points = mixed_code_points(20);
+    int16_t               width;
+    std::string           str = to_string(code_points, &width);
+
+    draw(make_test_font(unicode_glyphs, line_height, 1, IMAGE_COMPRESSED_RLE), str, width);
+    EXPECT_EQ(painter_test_take_transactions().viewport, code_points.size());
+}
+
+TEST_F(TextRun, MatchesGlyphByGlyphRendering) {
+    // Long enough to need several transfers of the pixel data buffer, with rows that don't start on byte boundaries
+    std::vector<uint32_t> code_points = mixed_code_points(80);
+    int16_t               width;
+    std::string           str = to_string(code_points, &width);
+    ASSERT_LE(width, panel_width);
+
+    for (uint8_t bpp : {1, 2, 4}) {
+        SCOPED_TRACE(bpp);
+        SetUp();
+        std::vector<uint16_t> by_glyph = draw(make_test_font(unicode_glyphs, line_height, bpp, IMAGE_COMPRESSED_RLE), str, width);
+        SetUp();
+        std::vector<uint16_t>       by_run       = draw(make_test_font(unicode_glyphs, line_height, bpp), str, width);
+        painter_test_transactions_t transactions = painter_test_take_transactions();
+        EXPECT_EQ(transactions.viewport, 1);
+        EXPECT_GT(transactions.pixdata, 1);
+        EXPECT_EQ(by_run, by_glyph);
+    }
+}
+
+TEST_F(TextRun, MissingGlyphDrawsNothing) {
+    std::string str = "ab" + utf8(0x0416) + "cd";
+
+    std::vector<uint8_t>  font_data = make_test_font(unicode_glyphs, line_height);
+    painter_font_handle_t font      = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, str.c_str()), 0);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, ""), 0);
+    qp_close_font(font);
+    EXPECT_EQ(painter_test_take_transactions().viewport, 0);
+    EXPECT_EQ(framebuffer[0], 0x5555);
+}
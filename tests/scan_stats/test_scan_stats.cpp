@@ -0,0 +1,139 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "scan_stats.h"
+void advance_time_us(uint32_t us);
+}
+
+using testing::_;
+using testing::AllOf;
+using testing::AnyNumber;
+using testing::Ge;
+using testing::Lt;
+
+// Percentiles are the end of their bucket, and a bucket spans a quarter of a doubling
+#define EXPECT_PERCENTILE(value, expected) EXPECT_THAT(value, AllOf(Ge(expected), Lt((expected) * 5 / 4)))
+
+// In microseconds
+static uint32_t stall = 0;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (record->event.pressed) {
+        advance_time_us(stall);
+    }
+    return true;
+}
+
+class ScanStats : public TestFixture {
+   protected:
+    void SetUp() override {
+        stall = 0;
+        scan_stats_reset();
+    }
+};
+
+TEST_F(ScanStats, SteadyScanRate) {
+    TestDriver driver;
+
+    // The test fixture scans once every millisecond, the first scan starts the window
+    idle_for(SCAN_STATS_WINDOW + 1);
+
+    const scan_stats_t *stats = scan_stats_get();
+    EXPECT_EQ(stats->scans, SCAN_STATS_WINDOW);
+    EXPECT_EQ(stats->window, SCAN_STATS_WINDOW);
+    EXPECT_EQ(stats->period_avg_us, 1000);
+    EXPECT_EQ(stats->period_min, 1000);
+    EXPECT_EQ(stats->period_max, 1000);
+    EXPECT_PERCENTILE(stats->period_p50, 1000);
+    EXPECT_PERCENTILE(stats->period_p99, 1000);
+    // Time advances between scans, which is outside of keyboard_task()
+    EXPECT_EQ(stats->worst_task, SCAN_STATS_TASK_MAIN_LOOP);
+    EXPECT_EQ(stats->worst_task_time, 1000);
+    EXPECT_EQ(get_matrix_scan_rate(), 1000);
+}
+
+TEST_F(ScanStats, StallIsAttributedToItsTask) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    idle_for(100);
+    stall = 5000;
+    key.press();
+    idle_for(SCAN_STATS_WINDOW);
+    stall = 0;
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const scan_stats_t *stats = scan_stats_get();
+    EXPECT_EQ(stats->scans, SCAN_STATS_WINDOW - 5);
+    EXPECT_EQ(stats->period_min, 1000);
+    EXPECT_EQ(stats->period_max, 6000);
+    EXPECT_PERCENTILE(stats->period_p99, 1000);
+    EXPECT_EQ(stats->worst_task, SCAN_STATS_TASK_MATRIX);
+    EXPECT_EQ(stats->worst_task_time, 5000);
+}
+
+TEST_F(ScanStats, SubMillisecondStallIsMeasured) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    idle_for(100);
+    stall = 250;
+    key.press();
+    idle_for(SCAN_STATS_WINDOW);
+    stall = 0;
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const scan_stats_t *stats = scan_stats_get();
+    EXPECT_EQ(stats->period_min, 1000);
+    EXPECT_EQ(stats->period_max, 1250);
+    EXPECT_PERCENTILE(stats->period_p50, 1000);
+    EXPECT_EQ(stats->period_avg_us, (SCAN_STATS_WINDOW * 1000 + 250) / stats->scans);
+}
+
+TEST_F(ScanStats, StallsShowInThePercentiles) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    // Every twentieth scan takes 3ms longer
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    stall = 3000;
+    for (uint8_t i = 0; i < 100; i++) {
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        idle_for(19);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    const scan_stats_t *stats = scan_stats_get();
+    EXPECT_PERCENTILE(stats->period_p50, 1000);
+    EXPECT_PERCENTILE(stats->period_p90, 1000);
+    EXPECT_PERCENTILE(stats->period_p99, 4000);
+    EXPECT_EQ(stats->period_max, 4000);
+}
+
+TEST_F(ScanStats, ResetDiscardsTheWindow) {
+    TestDriver driver;
+
+    idle_for(SCAN_STATS_WINDOW + 1);
+    EXPECT_NE(scan_stats_get()->scans, 0);
+
+    scan_stats_reset();
+    EXPECT_EQ(scan_stats_get()->scans, 0);
+    EXPECT_EQ(get_matrix_scan_rate(), 0);
+}
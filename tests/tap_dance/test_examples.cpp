@@ -254,6 +254,33 @@ TEST_F(TapDance, TapHold) {
     run_one_scan_loop();
 }
 
+TEST_F(TapDance, HeldDancesSharingAStateSlot) {
+    TestDriver driver;
+    InSequence s;
+    // With the default of 3 simultaneous tap dances, both of these start looking for a state in the same slot
+    auto key_esc_caps = KeymapKey{0, 1, 0, TD(TD_ESC_CAPS)};
+    auto key_cln      = KeymapKey{0, 2, 0, TD(CT_CLN)};
+
+    set_keymap({key_esc_caps, key_cln});
+
+    key_esc_caps.press();
+    idle_for(TAPPING_TERM + 1);
+
+    key_cln.press();
+    EXPECT_REPORT(driver, (KC_ESC));
+    idle_for(TAPPING_TERM + 1);
+
+    key_esc_caps.release();
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_SCLN));
+    run_one_scan_loop();
+
+    key_cln.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
 TEST_F(TapDance, QuadFunction) {
     TestDriver driver;
     InSequence s;
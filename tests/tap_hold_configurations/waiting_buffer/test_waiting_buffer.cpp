@@ -0,0 +1,145 @@
+/* Copyright 2026 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+struct processed_event_t {
+    uint8_t row;
+    uint8_t col;
+    bool    pressed;
+
+    bool operator==(const processed_event_t& other) const {
+        return row == other.row && col == other.col && pressed == other.pressed;
+    }
+};
+
+std::ostream& operator<<(std::ostream& os, const processed_event_t& event) {
+    return os << "(" << +event.row << "," << +event.col << (event.pressed ? " down)" : " up)");
+}
+
+static std::vector<processed_event_t> processed;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    processed.push_back({record->event.key.row, record->event.key.col, record->event.pressed});
+    return true;
+}
+
+class WaitingBuffer : public TestFixture {
+   protected:
+    void SetUp() override {
+        processed.clear();
+        waiting_buffer_reset_stats();
+    }
+};
+
+TEST_F(WaitingBuffer, FastRollKeepsEveryEventInOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    // A 20 key roll at 200 WPM -- a key every 60ms, each held for 150ms -- with every other key a mod-tap, so events
+    // keep queueing up behind undecided mod-taps.
+    std::vector<KeymapKey> keys;
+    for (uint8_t i = 0; i < 20; i++) {
+        uint16_t code = KC_A + i;
+        keys.emplace_back(0, i % MATRIX_COLS, i / MATRIX_COLS, (i % 2) ? code : LSFT_T(code));
+        add_key(keys.back());
+    }
+
+    // Each mod-tap is released while the next key is held, so it resolves as a tap and lets the next key's press out
+    // of the buffer. That key was pressed before the following mod-tap, so its release isn't held back behind it.
+    std::vector<processed_event_t> expected;
+    for (uint8_t i = 0; i < keys.size(); i += 2) {
+        const uint16_t tap = KC_A + i, next = KC_A + i + 1;
+        EXPECT_REPORT(driver, (tap));
+        EXPECT_REPORT(driver, (tap, next));
+        EXPECT_REPORT(driver, (next));
+        EXPECT_EMPTY_REPORT(driver);
+
+        const keypos_t tap_pos = keys[i].position, next_pos = keys[i + 1].position;
+        expected.push_back({tap_pos.row, tap_pos.col, true});
+        expected.push_back({next_pos.row, next_pos.col, true});
+        expected.push_back({tap_pos.row, tap_pos.col, false});
+        expected.push_back({next_pos.row, next_pos.col, false});
+    }
+
+    struct scheduled_t {
+        uint32_t time;
+        uint8_t  key;
+        bool     pressed;
+    };
+    std::vector<scheduled_t> schedule;
+    for (uint8_t i = 0; i < keys.size(); i++) {
+        schedule.push_back({i * 60u, i, true});
+        schedule.push_back({i * 60u + 150, i, false});
+    }
+    std::stable_sort(schedule.begin(), schedule.end(), [](const scheduled_t& a, const scheduled_t& b) { return a.time < b.time; });
+
+    uint32_t now = 0;
+    for (auto& event : schedule) {
+        idle_for(event.time - now);
+        now = event.time;
+        if (event.pressed) {
+            keys[event.key].press();
+        } else {
+            keys[event.key].release();
+        }
+    }
+    idle_for(TAPPING_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(processed, expected);
+    EXPECT_GT(waiting_buffer_get_high_water(), 1);
+    EXPECT_LT(waiting_buffer_get_high_water(), WAITING_BUFFER_SIZE);
+    EXPECT_EQ(waiting_buffer_get_overflows(), 0);
+}
+
+TEST_F(WaitingBuffer, OverflowIsCounted) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    auto mod_tap_key = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    auto regular_key = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({mod_tap_key, regular_key});
+
+    // Every tap of the regular key queues two events behind the undecided mod-tap
+    mod_tap_key.press();
+    run_one_scan_loop();
+    for (uint8_t i = 0; i < WAITING_BUFFER_SIZE / 2; i++) {
+        tap_key(regular_key);
+    }
+    EXPECT_EQ(waiting_buffer_get_high_water(), WAITING_BUFFER_SIZE - 1);
+    EXPECT_EQ(waiting_buffer_get_overflows(), 1);
+
+    mod_tap_key.release();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    waiting_buffer_reset_stats();
+    EXPECT_EQ(waiting_buffer_get_high_water(), 0);
+    EXPECT_EQ(waiting_buffer_get_overflows(), 0);
+}
@@ -17,15 +17,40 @@
 #include "matrix.h"
 #include "test_matrix.h"
 #include <string.h>
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
+#ifdef MATRIX_IDLE_TIMEOUT
+static bool matrix_idle_armed = false;
+
+bool matrix_idle_arm(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix[row]) {
+            return false;
+        }
+    }
+    matrix_idle_armed = true;
+    return true;
+}
+
+void matrix_idle_disarm(void) {
+    matrix_idle_armed = false;
+}
+#endif
+
 void matrix_init(void) {
     clear_all_keys();
     matrix_init_kb();
 }
 
 uint8_t matrix_scan(void) {
+#ifdef LATENCY_TRACE_ENABLE
+    // Keys change without bouncing, so the raw matrix is the matrix itself
+    latency_trace_matrix_changed(matrix);
+#endif
     matrix_scan_kb();
     return 1;
 }
@@ -42,6 +67,11 @@ void matrix_scan_kb(void) {}
 
 void press_key(uint8_t col, uint8_t row) {
     matrix[row] |= (matrix_row_t)1 << col;
+#ifdef MATRIX_IDLE_TIMEOUT
+    if (matrix_idle_armed) {
+        matrix_idle_wakeup();
+    }
+#endif
 }
 
 void release_key(uint8_t col, uint8_t row) {
@@ -23,66 +23,62 @@
 #include "util.h"
 #include <string.h>
 
+/*
+ * Pressed keys are tracked in a single 256-bit bitmap, independent of the report format currently in use. The 6KRO and
+ * NKRO reports are only derived from it when a report is about to be sent, see update_keyboard_report_keys() and
+ * update_nkro_report_bits().
+ */
+#define KEY_BITMAP_WORDS (256 / 32)
+
+static union {
+    uint32_t words[KEY_BITMAP_WORDS];
+    uint8_t  bytes[KEY_BITMAP_WORDS * 4];
+} key_bitmap;
+static uint16_t key_bitmap_count;
+
+static inline bool key_bitmap_get(uint8_t code) {
+    return key_bitmap.bytes[code >> 3] & (1 << (code & 7));
+}
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns non-zero if any key other than modifiers is pressed.
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
-#ifdef NKRO_ENABLE
-    if (host_can_send_nkro() && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
-    }
-#endif
-    while (lp--) {
-        if (*p++) cnt++;
+    uint8_t cnt = 0;
+    for (uint8_t i = 0; i < KEY_BITMAP_WORDS; i++) {
+        if (key_bitmap.words[i]) cnt++;
     }
     return cnt;
 }
 
 /** \brief get_first_key
  *
- * FIXME: Needs doc
+ * Returns the lowest keycode currently pressed, or KC_NO if none are.
  */
 uint8_t get_first_key(void) {
-#ifdef NKRO_ENABLE
-    if (host_can_send_nkro() && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
-            ;
-        return i << 3 | biton(nkro_report->bits[i]);
+    for (uint8_t i = 0; i < KEY_BITMAP_WORDS; i++) {
+        if (key_bitmap.words[i]) {
+            uint8_t byte = i * 4;
+            while (!key_bitmap.bytes[byte]) {
+                byte++;
+            }
+            return byte << 3 | biton(key_bitmap.bytes[byte] & -key_bitmap.bytes[byte]);
+        }
     }
-#endif
-    return keyboard_report->keys[0];
+    return KC_NO;
 }
 
 /** \brief Checks if a key is pressed in the report
  *
- * Returns true if the keyboard_report reports that the key is pressed, otherwise false
+ * Returns true if the key is pressed, otherwise false
  * Note: The function doesn't support modifiers currently, and it returns false for KC_NO
  */
 bool is_key_pressed(uint8_t key) {
     if (key == KC_NO) {
         return false;
     }
-#ifdef NKRO_ENABLE
-    if (host_can_send_nkro() && keymap_config.nkro) {
-        if ((key >> 3) < NKRO_REPORT_BITS) {
-            return nkro_report->bits[key >> 3] & 1 << (key & 7);
-        } else {
-            return false;
-        }
-    }
-#endif
-    for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
-        if (keyboard_report->keys[i] == key) {
-            return true;
-        }
-    }
-    return false;
+    return key_bitmap_get(key);
 }
 
 /** \brief add key byte
@@ -147,47 +143,89 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
 
 /** \brief add key to report
  *
- * FIXME: Needs doc
+ * Marks the key as pressed, the report itself is updated when it is next sent.
  */
 void add_key_to_report(uint8_t key) {
-#ifdef NKRO_ENABLE
-    if (host_can_send_nkro() && keymap_config.nkro) {
-        add_key_bit(nkro_report, key);
+    if (key == KC_NO || key_bitmap_get(key)) {
         return;
     }
-#endif
-    add_key_byte(keyboard_report, key);
+    key_bitmap.bytes[key >> 3] |= 1 << (key & 7);
+    key_bitmap_count++;
 }
 
 /** \brief del key from report
  *
- * FIXME: Needs doc
+ * Marks the key as released, the report itself is updated when it is next sent.
  */
 void del_key_from_report(uint8_t key) {
-#ifdef NKRO_ENABLE
-    if (host_can_send_nkro() && keymap_config.nkro) {
-        del_key_bit(nkro_report, key);
+    if (key == KC_NO || !key_bitmap_get(key)) {
         return;
     }
-#endif
-    del_key_byte(keyboard_report, key);
+    key_bitmap.bytes[key >> 3] &= ~(1 << (key & 7));
+    key_bitmap_count--;
 }
 
 /** \brief clear key from report
  *
- * FIXME: Needs doc
+ * Releases all keys, the report itself is updated when it is next sent.
  */
 void clear_keys_from_report(void) {
     // not clear mods
-#ifdef NKRO_ENABLE
-    if (host_can_send_nkro() && keymap_config.nkro) {
-        memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+    memset(&key_bitmap, 0, sizeof(key_bitmap));
+    key_bitmap_count = 0;
+}
+
+/** \brief update keyboard report keys
+ *
+ * Brings the keys of the 6KRO report in line with the pressed keys. Keys that are still held keep their position,
+ * released keys leave an empty slot, and empty slots are filled with held keys that didn't fit in the report before,
+ * lowest keycode first.
+ */
+void update_keyboard_report_keys(report_keyboard_t* keyboard_report) {
+    uint8_t used = 0;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t code = keyboard_report->keys[i];
+        if (code && !key_bitmap_get(code)) {
+            keyboard_report->keys[i] = 0;
+        } else if (code) {
+            used++;
+        }
+    }
+
+    // Everything that is held is already in the report
+    if (used == key_bitmap_count || used == KEYBOARD_REPORT_KEYS) {
         return;
     }
-#endif
-    memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
+
+    for (uint8_t i = 0; i < KEY_BITMAP_WORDS && used < KEYBOARD_REPORT_KEYS; i++) {
+        if (!key_bitmap.words[i]) {
+            continue;
+        }
+        for (uint8_t byte = i * 4; byte < (i + 1) * 4; byte++) {
+            uint8_t bits = key_bitmap.bytes[byte];
+            while (bits && used < KEYBOARD_REPORT_KEYS) {
+                uint8_t lowest = bits & -bits;
+                uint8_t code   = byte << 3 | biton(lowest);
+                bits &= ~lowest;
+                if (!memchr(keyboard_report->keys, code, KEYBOARD_REPORT_KEYS)) {
+                    add_key_byte(keyboard_report, code);
+                    used++;
+                }
+            }
+        }
+    }
 }
 
+#ifdef NKRO_ENABLE
+/** \brief update nkro report bits
+ *
+ * Copies the pressed keys into the NKRO report, keycodes that don't fit in the report are dropped.
+ */
+void update_nkro_report_bits(report_nkro_t* nkro_report) {
+    memcpy(nkro_report->bits, key_bitmap.bytes, sizeof(nkro_report->bits));
+}
+#endif
+
 #ifdef MOUSE_ENABLE
 /**
  * @brief Compares 2 mouse reports for difference and returns result. Empty
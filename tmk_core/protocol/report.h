@@ -355,6 +355,11 @@ void add_key_to_report(uint8_t key);
 void del_key_from_report(uint8_t key);
 void clear_keys_from_report(void);
 
+void update_keyboard_report_keys(report_keyboard_t* keyboard_report);
+#ifdef NKRO_ENABLE
+void update_nkro_report_bits(report_nkro_t* nkro_report);
+#endif
+
 #ifdef MOUSE_ENABLE
 bool has_mouse_report_changed(report_mouse_t* new_report, report_mouse_t* old_report);
 #endif